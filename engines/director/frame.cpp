@@ -626,9 +626,21 @@ void Frame::renderSprites(Graphics::ManagedSurface &surface, bool renderTrail) {
 				int height = _sprites[i]->_height;
 				int width = _vm->getVersion() > 4 ? _sprites[i]->_bitmapCast->initialRect.width() : _sprites[i]->_width;
 
+				// The bitmap is decoded by the score owning the cast
+				Score *score = _vm->getCurrentScore();
+				Score *sharedScore = _vm->getSharedScore();
+				if (sharedScore && sharedScore->_loadedBitmaps->getVal(_sprites[i]->_castId, nullptr) == _sprites[i]->_bitmapCast)
+					score = sharedScore;
+
+				const Graphics::Surface *bitmap = score->getBitmapSurface(_sprites[i]->_castId);
+				if (!bitmap) {
+					warning("No bitmap for cast %d of sprite %d", _sprites[i]->_castId, i);
+					continue;
+				}
+
 				Common::Rect drawRect(x, y, x + width, y + height);
 				addDrawRect(i, drawRect);
-				inkBasedBlit(surface, *(_sprites[i]->_bitmapCast->surface), i, drawRect);
+				inkBasedBlit(surface, *bitmap, i, drawRect);
 			}
 		}
 	}
@@ -41,7 +41,7 @@ DIBDecoder::~DIBDecoder() {
 }
 
 void DIBDecoder::destroy() {
-	delete _surface;
+	// The surface belongs to the codec
 	_surface = 0;
 
 	delete[] _palette;
@@ -130,6 +130,10 @@ BITDDecoder::~BITDDecoder() {
 }
 
 void BITDDecoder::destroy() {
+	if (_surface) {
+		_surface->free();
+		delete _surface;
+	}
 	_surface = 0;
 
 	delete[] _palette;
@@ -248,6 +252,10 @@ BITDDecoderV4::~BITDDecoderV4() {
 }
 
 void BITDDecoderV4::destroy() {
+	if (_surface) {
+		_surface->free();
+		delete _surface;
+	}
 	_surface = 0;
 
 	delete[] _palette;
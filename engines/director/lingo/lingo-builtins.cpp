@@ -1168,7 +1168,7 @@ void Lingo::b_move(int nargs) {
 }
 
 void Lingo::b_moveableSprite(int nargs) {
-	Frame *frame = g_director->getCurrentScore()->_frames[g_director->getCurrentScore()->getCurrentFrame()];
+	Frame *frame = g_director->getCurrentScore()->getFrame(g_director->getCurrentScore()->getCurrentFrame());
 
 	// Will have no effect
 	frame->_sprites[g_lingo->_currentEntityId]->_moveable = true;
@@ -1231,7 +1231,7 @@ void Lingo::b_rollOver(int nargs) {
 
 	d.u.i = 0; // FALSE
 
-	Frame *frame = g_director->getCurrentScore()->_frames[g_director->getCurrentScore()->getCurrentFrame()];
+	Frame *frame = g_director->getCurrentScore()->getFrame(g_director->getCurrentScore()->getCurrentFrame());
 
 	if (arg >= (int32) frame->_sprites.size()) {
 		g_lingo->push(d);
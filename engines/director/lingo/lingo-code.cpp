@@ -275,7 +275,7 @@ void Lingo::c_varpush() {
 		return;
 	}
 
-	d.u.sym = g_lingo->lookupVar(name.c_str());
+	d.u.sym = g_lingo->lookupVar(name);
 	if (d.u.sym->type == CASTREF) {
 		d.type = INT;
 		int val = d.u.sym->u.i;
@@ -868,7 +868,7 @@ void Lingo::c_repeatwithcode(void) {
 	int inc = (int32)READ_UINT32(&(*g_lingo->_currentScript)[savepc + 3]);
 	uint end =  READ_UINT32(&(*g_lingo->_currentScript)[savepc + 4]);
 	Common::String countername((char *)&(*g_lingo->_currentScript)[savepc + 5]);
-	Symbol *counter = g_lingo->lookupVar(countername.c_str());
+	Symbol *counter = g_lingo->lookupVar(countername);
 
 	if (counter->type == CASTREF) {
 		error("Cast ref used as index: %s", countername.c_str());
@@ -1033,7 +1033,7 @@ void Lingo::call(Common::String name, int nargs) {
 	Symbol *sym = g_lingo->getHandler(name);
 
 	if (!g_lingo->_eventHandlerTypeIds.contains(name)) {
-		Symbol *s = g_lingo->lookupVar(name.c_str(), false);
+		Symbol *s = g_lingo->lookupVar(name, false);
 		if (s && s->type == OBJECT) {
 			debugC(3, kDebugLingoExec,  "Dereferencing object reference: %s to %s", name.c_str(), s->u.s->c_str());
 			name = *s->u.s;
@@ -1150,12 +1150,12 @@ void Lingo::c_procret() {
 void Lingo::c_global() {
 	Common::String name((char *)&(*g_lingo->_currentScript)[g_lingo->_pc]);
 
-	Symbol *s = g_lingo->lookupVar(name.c_str(), false);
+	Symbol *s = g_lingo->lookupVar(name, false);
 	if (s && !s->global) {
 		warning("Local variable %s declared as global", name.c_str());
 	}
 
-	s = g_lingo->lookupVar(name.c_str(), true, true);
+	s = g_lingo->lookupVar(name, true, true);
 	s->global = true;
 
 	g_lingo->_pc += g_lingo->calcStringAlignment(name.c_str());
@@ -54,12 +54,12 @@ namespace Director {
 
 void Lingo::execute(uint pc) {
 	for(_pc = pc; (*_currentScript)[_pc] != STOP && !_returning;) {
-		Common::String instr = decodeInstruction(_pc);
-
 		if (debugChannelSet(5, kDebugLingoExec))
 			printStack("Stack before: ");
 
-		debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+		// Decoding formats the whole instruction, so only do it for the trace
+		if (debugChannelSet(1, kDebugLingoExec))
+			debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, decodeInstruction(_pc).c_str());
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
@@ -142,16 +142,16 @@ Common::String Lingo::decodeInstruction(uint pc, uint *newPc) {
 	return res;
 }
 
-Symbol *Lingo::lookupVar(const char *name, bool create, bool putInGlobalList) {
+Symbol *Lingo::lookupVar(const Common::String &name, bool create, bool putInGlobalList) {
 	Symbol *sym = nullptr;
 
 	// Looking for the cast member constants
 	if (_vm->getVersion() < 4) { // TODO: There could be a flag 'Allow Outdated Lingo' in Movie Info in D4
-		int val = castNumToNum(name);
+		int val = castNumToNum(name.c_str());
 
 		if (val != -1) {
 			if (!create)
-				error("Cast reference used in wrong context: %s", name);
+				error("Cast reference used in wrong context: %s", name.c_str());
 
 			sym = new Symbol;
 
@@ -162,10 +162,16 @@ Symbol *Lingo::lookupVar(const char *name, bool create, bool putInGlobalList) {
 		}
 	}
 
-	if (!_localvars || !_localvars->contains(name)) { // Create variable if it was not defined
+	// Every variable access ends up here, so hash the name as few times as possible
+	SymbolHash::iterator local;
+	if (_localvars)
+		local = _localvars->find(name);
+
+	if (!_localvars || local == _localvars->end()) { // Create variable if it was not defined
 		// Check if it is a global symbol
-		if (_globalvars.contains(name) && _globalvars[name]->type == SYMBOL)
-			return _globalvars[name];
+		SymbolHash::iterator global = _globalvars.find(name);
+		if (global != _globalvars.end() && global->_value->type == SYMBOL)
+			return global->_value;
 
 		if (!create)
 			return NULL;
@@ -183,7 +189,7 @@ Symbol *Lingo::lookupVar(const char *name, bool create, bool putInGlobalList) {
 			_globalvars[name] = sym;
 		}
 	} else {
-		sym = (*_localvars)[name];
+		sym = local->_value;
 
 		if (sym->global)
 			sym = _globalvars[name];
@@ -92,18 +92,17 @@ ScriptType Lingo::event2script(LEvent ev) {
 }
 
 Symbol *Lingo::getHandler(Common::String &name) {
-	if (!_eventHandlerTypeIds.contains(name)) {
-		if (_builtins.contains(name))
-			return _builtins[name];
+	Common::HashMap<Common::String, uint32>::iterator eventType = _eventHandlerTypeIds.find(name);
 
-		return NULL;
+	if (eventType == _eventHandlerTypeIds.end()) {
+		SymbolHash::iterator builtin = _builtins.find(name);
+
+		return builtin != _builtins.end() ? builtin->_value : NULL;
 	}
 
-	uint32 entityIndex = ENTITY_INDEX(_eventHandlerTypeIds[name], _currentEntityId);
-	if (!_handlers.contains(entityIndex))
-		return NULL;
+	Common::HashMap<uint32, Symbol *>::iterator handler = _handlers.find(ENTITY_INDEX(eventType->_value, _currentEntityId));
 
-	return _handlers[entityIndex];
+	return handler != _handlers.end() ? handler->_value : NULL;
 }
 
 void Lingo::primaryEventHandler(LEvent event) {
@@ -151,7 +150,7 @@ void Lingo::processInputEvent(LEvent event) {
 	 * [D4 docs] */
 
 	Score *score = _vm->getCurrentScore();
-	Frame *currentFrame = score->_frames[score->getCurrentFrame()];
+	Frame *currentFrame = score->getFrame(score->getCurrentFrame());
 	assert(currentFrame != nullptr);
 	uint16 spriteId = score->_currentMouseDownSpriteId;
 
@@ -166,7 +165,7 @@ void Lingo::processInputEvent(LEvent event) {
 				g_lingo->processEvent(event, kSpriteScript, currentFrame->_sprites[spriteId]->_scriptId);
 			}
 			g_lingo->processEvent(event, kCastScript, currentFrame->_sprites[spriteId]->_castId);
-			g_lingo->processEvent(event, kFrameScript, score->_frames[score->getCurrentFrame()]->_actionId);
+			g_lingo->processEvent(event, kFrameScript, currentFrame->_actionId);
 			// TODO: Is the kFrameScript call above correct?
 		} else if (event == kEventMouseUp) {
 			// Frame script overrides sprite script
@@ -220,8 +219,9 @@ void Lingo::processFrameEvent(LEvent event) {
 		if (event == kEventPrepareFrame || event == kEventIdle) {
 			entity = score->getCurrentFrame();
 		} else {
-			assert(score->_frames[score->getCurrentFrame()] != nullptr);
-			entity = score->_frames[score->getCurrentFrame()]->_actionId;
+			Frame *currentFrame = score->getFrame(score->getCurrentFrame());
+			assert(currentFrame != nullptr);
+			entity = currentFrame->_actionId;
 		}
 		processEvent(event,
 		             kFrameScript,
@@ -242,7 +242,7 @@ void Lingo::processGenericEvent(LEvent event) {
 
 void Lingo::processSpriteEvent(LEvent event) {
 	Score *score = _vm->getCurrentScore();
-	Frame *currentFrame = score->_frames[score->getCurrentFrame()];
+	Frame *currentFrame = score->getFrame(score->getCurrentFrame());
 	if (event == kEventBeginSprite) {
 		// TODO: Check if this is also possibly a kSpriteScript?
 		for (uint16 i = 0; i < CHANNEL_COUNT; i++)
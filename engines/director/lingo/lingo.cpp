@@ -23,6 +23,7 @@
 #include "common/archive.h"
 #include "common/file.h"
 #include "common/str-array.h"
+#include "common/system.h"
 
 #include "director/lingo/lingo.h"
 #include "director/lingo/lingo-gr.h"
@@ -69,6 +70,9 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 
 	_localvars = NULL;
 
+	// Keep pushes during deeply nested expressions from reallocating
+	_stack.reserve(kStackReserve);
+
 	initEventHandlerTypes();
 
 	initBuiltIns();
@@ -388,12 +392,19 @@ void Lingo::runTests() {
 			debug(">> Compiling file %s of size %d, id: %d", fileList[i].c_str(), size, counter);
 
 			_hadError = false;
+
+			uint32 startTime = g_system->getMillis();
 			addCode(script, kMovieScript, counter);
+			uint32 compileTime = g_system->getMillis() - startTime;
 
-			if (!_hadError)
+			if (!_hadError) {
+				startTime = g_system->getMillis();
 				executeScript(kMovieScript, counter);
-			else
+
+				debug(">> Compiled %s in %d ms, executed in %d ms", fileList[i].c_str(), compileTime, g_system->getMillis() - startTime);
+			} else {
 				debug(">> Skipping execution");
+			}
 
 			free(script);
 
@@ -196,7 +196,7 @@ public:
 	void execute(uint pc);
 	void pushContext();
 	void popContext();
-	Symbol *lookupVar(const char *name, bool create = true, bool putInGlobalList = false);
+	Symbol *lookupVar(const Common::String &name, bool create = true, bool putInGlobalList = false);
 	void cleanLocalVars();
 	void define(Common::String &s, int start, int nargs, Common::String *prefix = NULL, int end = -1);
 	void processIf(int elselabel, int endlabel);
@@ -559,6 +559,10 @@ private:
 
 	uint _pc;
 
+	enum {
+		kStackReserve = 64
+	};
+
 	StackData _stack;
 
 	DirectorEngine *_vm;
@@ -84,6 +84,11 @@ Score::Score(DirectorEngine *vm) {
 	_flags = 0;
 	_stopPlay = false;
 	_stageColor = 0;
+	_frameDataBE = false;
+
+	_bitmapCacheSize = 0;
+	_bitmapCacheClock = 0;
+	_isSharedCast = false;
 
 	_loadedBitmaps = new Common::HashMap<int, BitmapCast *>();
 	_loadedText = new Common::HashMap<int, TextCast *>();
@@ -214,73 +219,152 @@ void Score::copyCastStxts() {
 }
 
 void Score::loadSpriteImages(bool isSharedCast) {
-	debugC(1, kDebugLoading, "****** Preloading sprite images");
-
-	Common::HashMap<int, BitmapCast *>::iterator bc;
-	for (bc = _loadedBitmaps->begin(); bc != _loadedBitmaps->end(); ++bc) {
-		if (bc->_value) {
-			uint32 tag = bc->_value->tag;
-			uint16 imgId = bc->_key + 1024;
-			BitmapCast *bitmapCast = bc->_value;
-
-			if (_vm->getVersion() >= 4 && bitmapCast->children.size() > 0) {
-				imgId = bitmapCast->children[0].index;
-				tag = bitmapCast->children[0].tag;
-			}
+	debugC(1, kDebugLoading, "****** Deferring %d sprite images", _loadedBitmaps->size());
 
-			Image::ImageDecoder *img = NULL;
-			Common::SeekableReadStream *pic = NULL;
-
-			switch (tag) {
-			case MKTAG('D', 'I', 'B', ' '):
-				if (_movieArchive->hasResource(MKTAG('D', 'I', 'B', ' '), imgId)) {
-					img = new DIBDecoder();
-					img->loadStream(*_movieArchive->getResource(MKTAG('D', 'I', 'B', ' '), imgId));
-					bitmapCast->surface = img->getSurface();
-				} else if (isSharedCast && _vm->getSharedDIB() != NULL && _vm->getSharedDIB()->contains(imgId)) {
-					img = new DIBDecoder();
-					img->loadStream(*_vm->getSharedDIB()->getVal(imgId));
-					bitmapCast->surface = img->getSurface();
-				}
-				break;
-			case MKTAG('B', 'I', 'T', 'D'):
-				if (isSharedCast) {
-					debugC(4, kDebugImages, "Shared cast BMP: id: %d", imgId);
-					pic = _vm->getSharedBMP()->getVal(imgId);
-					if (pic != NULL)
-						pic->seek(0); // TODO: this actually gets re-read every loop... we need to rewind it!
-				} else 	if (_movieArchive->hasResource(MKTAG('B', 'I', 'T', 'D'), imgId)) {
-					pic = _movieArchive->getResource(MKTAG('B', 'I', 'T', 'D'), imgId);
-				}
-				break;
-			default:
-				warning("Unknown Bitmap Cast Tag: [%d] %s", tag, tag2str(tag));
-				break;
-			}
+	// The images themselves are decoded by getBitmapSurface() once a
+	// sprite actually shows them
+	flushBitmapCache();
+	_isSharedCast = isSharedCast;
+}
 
-			int w = bitmapCast->initialRect.width(), h = bitmapCast->initialRect.height();
-			debugC(4, kDebugImages, "id: %d, w: %d, h: %d, flags: %x, some: %x, unk1: %d, unk2: %d",
-				imgId, w, h, bitmapCast->flags, bitmapCast->someFlaggyThing, bitmapCast->unk1, bitmapCast->unk2);
+const Graphics::Surface *Score::getBitmapSurface(int castId) {
+	BitmapCast *bitmapCast = _loadedBitmaps->getVal(castId, nullptr);
+	if (!bitmapCast)
+		return nullptr;
 
-			if (pic != NULL && bitmapCast != NULL && w > 0 && h > 0) {
-				if (_vm->getVersion() < 4) {
-					img = new BITDDecoder(w, h);
-				} else if (_vm->getVersion() < 6) {
-					img = new BITDDecoderV4(w, h, bitmapCast->bitsPerPixel);
-				} else {
-					img = new Image::BitmapDecoder();
-				}
+	if (_bitmapCache.contains(castId)) {
+		_bitmapCache[castId].lastUsed = ++_bitmapCacheClock;
+		return bitmapCast->surface;
+	}
+
+	BitmapCacheEntry entry;
+	entry.decoder = decodeBitmap(castId, bitmapCast);
+	entry.size = 0;
+	entry.lastUsed = ++_bitmapCacheClock;
+
+	// Failed images are cached too, so that they are not retried every frame
+	bitmapCast->surface = entry.decoder ? entry.decoder->getSurface() : nullptr;
+	if (bitmapCast->surface)
+		entry.size = bitmapCast->surface->pitch * bitmapCast->surface->h;
+
+	_bitmapCache[castId] = entry;
+	_bitmapCacheSize += entry.size;
+
+	evictBitmaps(castId);
+
+	return bitmapCast->surface;
+}
+
+Image::ImageDecoder *Score::decodeBitmap(int castId, BitmapCast *bitmapCast) {
+	uint32 tag = bitmapCast->tag;
+	uint16 imgId = castId + 1024;
+
+	if (_vm->getVersion() >= 4 && bitmapCast->children.size() > 0) {
+		imgId = bitmapCast->children[0].index;
+		tag = bitmapCast->children[0].tag;
+	}
+
+	Image::ImageDecoder *img = NULL;
+	Common::SeekableReadStream *pic = NULL;
+	bool ownsPic = false;
+
+	switch (tag) {
+	case MKTAG('D', 'I', 'B', ' '):
+		if (_movieArchive->hasResource(MKTAG('D', 'I', 'B', ' '), imgId)) {
+			pic = _movieArchive->getResource(MKTAG('D', 'I', 'B', ' '), imgId);
+			ownsPic = true;
+		} else if (_isSharedCast && _vm->getSharedDIB() != NULL && _vm->getSharedDIB()->contains(imgId)) {
+			pic = _vm->getSharedDIB()->getVal(imgId);
+			pic->seek(0);
+		}
 
-				img->loadStream(*pic);
-				bitmapCast->surface = img->getSurface();
+		if (pic != NULL)
+			img = new DIBDecoder();
+		break;
+	case MKTAG('B', 'I', 'T', 'D'): {
+		if (_isSharedCast) {
+			debugC(4, kDebugImages, "Shared cast BMP: id: %d", imgId);
+			pic = _vm->getSharedBMP()->getVal(imgId);
+			if (pic != NULL)
+				pic->seek(0); // The shared streams are decoded again after an eviction, so rewind them
+		} else 	if (_movieArchive->hasResource(MKTAG('B', 'I', 'T', 'D'), imgId)) {
+			pic = _movieArchive->getResource(MKTAG('B', 'I', 'T', 'D'), imgId);
+			ownsPic = true;
+		}
+
+		int w = bitmapCast->initialRect.width(), h = bitmapCast->initialRect.height();
+		debugC(4, kDebugImages, "id: %d, w: %d, h: %d, flags: %x, some: %x, unk1: %d, unk2: %d",
+			imgId, w, h, bitmapCast->flags, bitmapCast->someFlaggyThing, bitmapCast->unk1, bitmapCast->unk2);
+
+		if (pic != NULL && w > 0 && h > 0) {
+			if (_vm->getVersion() < 4) {
+				img = new BITDDecoder(w, h);
+			} else if (_vm->getVersion() < 6) {
+				img = new BITDDecoderV4(w, h, bitmapCast->bitsPerPixel);
 			} else {
-				warning("Image %d not found", imgId);
+				img = new Image::BitmapDecoder();
 			}
 		}
+		break;
 	}
+	default:
+		warning("Unknown Bitmap Cast Tag: [%d] %s", tag, tag2str(tag));
+		break;
+	}
+
+	if (img != NULL && !img->loadStream(*pic)) {
+		delete img;
+		img = NULL;
+	}
+
+	if (img == NULL || img->getSurface() == NULL)
+		warning("Image %d not found", imgId);
+
+	if (ownsPic)
+		delete pic;
+
+	return img;
+}
+
+void Score::evictBitmaps(int keepCastId) {
+	while (_bitmapCacheSize > kBitmapCacheSize) {
+		Common::HashMap<int, BitmapCacheEntry>::iterator victim = _bitmapCache.end();
+
+		for (Common::HashMap<int, BitmapCacheEntry>::iterator it = _bitmapCache.begin(); it != _bitmapCache.end(); ++it) {
+			if (it->_key == keepCastId || !it->_value.size)
+				continue;
+
+			if (victim == _bitmapCache.end() || it->_value.lastUsed < victim->_value.lastUsed)
+				victim = it;
+		}
+
+		if (victim == _bitmapCache.end())
+			break;
+
+		debugC(4, kDebugImages, "Evicting image of cast %d", victim->_key);
+
+		_loadedBitmaps->getVal(victim->_key)->surface = nullptr;
+		_bitmapCacheSize -= victim->_value.size;
+		delete victim->_value.decoder;
+		_bitmapCache.erase(victim);
+	}
+}
+
+void Score::flushBitmapCache() {
+	for (Common::HashMap<int, BitmapCacheEntry>::iterator it = _bitmapCache.begin(); it != _bitmapCache.end(); ++it) {
+		BitmapCast *bitmapCast = _loadedBitmaps->getVal(it->_key, nullptr);
+		if (bitmapCast)
+			bitmapCast->surface = nullptr;
+		delete it->_value.decoder;
+	}
+
+	_bitmapCache.clear();
+	_bitmapCacheSize = 0;
 }
 
 Score::~Score() {
+	flushBitmapCache();
+
 	if (_surface)
 		_surface->free();
 
@@ -384,12 +468,21 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 	byte channelData[kChannelDataSize];
 	memset(channelData, 0, kChannelDataSize);
 
+	// Frame 0 has no deltas and its channel data is the first keyframe
+	_frameDataBE = stream.isBE();
+	_frameDeltas.clear();
+	_frameDeltaOffsets.clear();
+	_frameDeltaOffsets.push_back(0);
+	_frameDeltaOffsets.push_back(0);
+	_keyframes.clear();
+	_keyframes.resize(kChannelDataSize);
+	memcpy(&_keyframes[0], channelData, kChannelDataSize);
+
 	while (size != 0 && !stream.eos()) {
 		uint16 frameSize = stream.readUint16();
 		debugC(kDebugLoading, 8, "++++ score frame %d (frameSize %d) size %d", _frames.size(), frameSize, size);
 
 		if (frameSize > 0) {
-			Frame *frame = new Frame(_vm);
 			size -= frameSize;
 			frameSize -= 2;
 
@@ -407,16 +500,26 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 
 				assert(channelOffset + channelSize < kChannelDataSize);
 				stream.read(&channelData[channelOffset], channelSize);
+
+				// Keep the delta as offset, size and data in little endian
+				uint32 pos = _frameDeltas.size();
+				_frameDeltas.resize(pos + 4 + channelSize);
+				WRITE_LE_UINT16(&_frameDeltas[pos], channelOffset);
+				WRITE_LE_UINT16(&_frameDeltas[pos + 2], channelSize);
+				if (channelSize)
+					memcpy(&_frameDeltas[pos + 4], &channelData[channelOffset], channelSize);
 			}
 
-			Common::MemoryReadStreamEndian *str = new Common::MemoryReadStreamEndian(channelData, ARRAYSIZE(channelData), stream.isBE());
-			// str->hexdump(str->size(), 32);
-			frame->readChannels(str);
-			delete str;
+			_frameDeltaOffsets.push_back(_frameDeltas.size());
 
-			debugC(3, kDebugLoading, "Frame %d actionId: %d", _frames.size(), frame->_actionId);
+			if (_frames.size() % kKeyframeInterval == 0) {
+				uint32 pos = _keyframes.size();
+				_keyframes.resize(pos + kChannelDataSize);
+				memcpy(&_keyframes[pos], channelData, kChannelDataSize);
+			}
 
-			_frames.push_back(frame);
+			// Decoded by getFrame()
+			_frames.push_back(nullptr);
 		} else {
 			warning("zero sized frame!? exiting loop until we know what to do with the tags that follow.");
 			size = 0;
@@ -424,6 +527,54 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 	}
 }
 
+Frame *Score::getFrame(uint16 frameId) {
+	if (frameId >= _frames.size())
+		return nullptr;
+
+	if (!_frames[frameId])
+		_frames[frameId] = decodeFrame(frameId);
+
+	return _frames[frameId];
+}
+
+Frame *Score::decodeFrame(uint16 frameId) {
+	byte channelData[kChannelDataSize];
+
+	uint16 keyframe = frameId / kKeyframeInterval;
+	memcpy(channelData, &_keyframes[keyframe * kChannelDataSize], kChannelDataSize);
+
+	for (uint16 i = keyframe * kKeyframeInterval + 1; i <= frameId; i++)
+		applyFrameDelta(channelData, i);
+
+	Frame *frame = new Frame(_vm);
+
+	Common::MemoryReadStreamEndian *str = new Common::MemoryReadStreamEndian(channelData, ARRAYSIZE(channelData), _frameDataBE);
+	// str->hexdump(str->size(), 32);
+	frame->readChannels(str);
+	delete str;
+
+	debugC(3, kDebugLoading, "Frame %d actionId: %d", frameId, frame->_actionId);
+
+	setSpriteCasts(frame);
+
+	return frame;
+}
+
+void Score::applyFrameDelta(byte *channelData, uint16 frameId) const {
+	uint32 pos = _frameDeltaOffsets[frameId];
+	uint32 end = _frameDeltaOffsets[frameId + 1];
+
+	while (pos < end) {
+		uint16 channelOffset = READ_LE_UINT16(&_frameDeltas[pos]);
+		uint16 channelSize = READ_LE_UINT16(&_frameDeltas[pos + 2]);
+		pos += 4;
+
+		if (channelSize)
+			memcpy(&channelData[channelOffset], &_frameDeltas[pos], channelSize);
+		pos += channelSize;
+	}
+}
+
 void Score::loadConfig(Common::SeekableSubReadStreamEndian &stream) {
 	debugC(1, kDebugLoading, "****** Loading Config");
 
@@ -489,43 +640,50 @@ void Score::loadCastDataVWCR(Common::SeekableSubReadStreamEndian &stream) {
 }
 
 void Score::setSpriteCasts() {
-	// Set cast pointers to sprites
+	// Frames that are not decoded yet get their casts in getFrame()
 	for (uint16 i = 0; i < _frames.size(); i++) {
-		for (uint16 j = 0; j < _frames[i]->_sprites.size(); j++) {
-			uint16 castId = _frames[i]->_sprites[j]->_castId;
+		if (_frames[i])
+			setSpriteCasts(_frames[i]);
+	}
+}
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedBitmaps->contains(castId)) {
-				_frames[i]->_sprites[j]->_bitmapCast = _vm->getSharedScore()->_loadedBitmaps->getVal(castId);
-			} else if (_loadedBitmaps->contains(castId)) {
-				_frames[i]->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
-			}
+void Score::setSpriteCasts(Frame *frame) {
+	// Set cast pointers to sprites
+	for (uint16 j = 0; j < frame->_sprites.size(); j++) {
+		Sprite *sprite = frame->_sprites[j];
+		uint16 castId = sprite->_castId;
+
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedBitmaps->contains(castId)) {
+			sprite->_bitmapCast = _vm->getSharedScore()->_loadedBitmaps->getVal(castId);
+		} else if (_loadedBitmaps->contains(castId)) {
+			sprite->_bitmapCast = _loadedBitmaps->getVal(castId);
+		}
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedButtons->contains(castId)) {
-				_frames[i]->_sprites[j]->_buttonCast = _vm->getSharedScore()->_loadedButtons->getVal(castId);
-				if (_frames[i]->_sprites[j]->_buttonCast->children.size() == 1) {
-					_frames[i]->_sprites[j]->_textCast =
-						_vm->getSharedScore()->_loadedText->getVal(_frames[i]->_sprites[j]->_buttonCast->children[0].index);
-				} else if (_frames[i]->_sprites[j]->_buttonCast->children.size() > 0) {
-					warning("Cast %d has too many children!", j);
-				}
-			} else if (_loadedButtons->contains(castId)) {
-				_frames[i]->_sprites[j]->_buttonCast = _loadedButtons->getVal(castId);
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedButtons->contains(castId)) {
+			sprite->_buttonCast = _vm->getSharedScore()->_loadedButtons->getVal(castId);
+			if (sprite->_buttonCast->children.size() == 1) {
+				sprite->_textCast =
+					_vm->getSharedScore()->_loadedText->getVal(sprite->_buttonCast->children[0].index);
+			} else if (sprite->_buttonCast->children.size() > 0) {
+				warning("Cast %d has too many children!", j);
 			}
+		} else if (_loadedButtons->contains(castId)) {
+			sprite->_buttonCast = _loadedButtons->getVal(castId);
+		}
 
-			//if (_loadedScripts->contains(castId))
-			//	_frames[i]->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
+		//if (_loadedScripts->contains(castId))
+		//	sprite->_bitmapCast = _loadedBitmaps->getVal(castId);
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedText->contains(castId)) {
-				_frames[i]->_sprites[j]->_textCast = _vm->getSharedScore()->_loadedText->getVal(castId);
-			} else if (_loadedText->contains(castId)) {
-				_frames[i]->_sprites[j]->_textCast = _loadedText->getVal(castId);
-			}
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedText->contains(castId)) {
+			sprite->_textCast = _vm->getSharedScore()->_loadedText->getVal(castId);
+		} else if (_loadedText->contains(castId)) {
+			sprite->_textCast = _loadedText->getVal(castId);
+		}
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedShapes->contains(castId)) {
-				_frames[i]->_sprites[j]->_shapeCast = _vm->getSharedScore()->_loadedShapes->getVal(castId);
-			} else if (_loadedShapes->contains(castId)) {
-				_frames[i]->_sprites[j]->_shapeCast = _loadedShapes->getVal(castId);
-			}
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedShapes->contains(castId)) {
+			sprite->_shapeCast = _vm->getSharedScore()->_loadedShapes->getVal(castId);
+		} else if (_loadedShapes->contains(castId)) {
+			sprite->_shapeCast = _loadedShapes->getVal(castId);
 		}
 	}
 }
@@ -1184,7 +1342,7 @@ void Score::startLoop() {
 	_stopPlay = false;
 	_nextFrameTime = 0;
 
-	_frames[_currentFrame]->prepareFrame(this);
+	getFrame(_currentFrame)->prepareFrame(this);
 
 	while (!_stopPlay && _currentFrame < _frames.size()) {
 		debugC(1, kDebugImages, "******************************  Current frame: %d", _currentFrame + 1);
@@ -1202,7 +1360,7 @@ void Score::update() {
 	_surface->clear();
 	_surface->copyFrom(*_trailSurface);
 
-	_lingo->executeImmediateScripts(_frames[_currentFrame]);
+	_lingo->executeImmediateScripts(getFrame(_currentFrame));
 
 	// Enter and exit from previous frame (Director 4)
 	_lingo->processEvent(kEventEnterFrame);
@@ -1233,10 +1391,11 @@ void Score::update() {
 	if (_currentFrame >= _frames.size())
 		return;
 
-	_frames[_currentFrame]->prepareFrame(this);
+	Frame *frame = getFrame(_currentFrame);
+	frame->prepareFrame(this);
 	// Stage is drawn between the prepareFrame and enterFrame events (Lingo in a Nutshell)
 
-	byte tempo = _frames[_currentFrame]->_tempo;
+	byte tempo = frame->_tempo;
 
 	if (tempo) {
 		if (tempo > 161) {
@@ -1273,12 +1432,13 @@ void Score::update() {
 }
 
 Sprite *Score::getSpriteById(uint16 id) {
-	if (_currentFrame >= _frames.size() || id >= _frames[_currentFrame]->_sprites.size()) {
+	Frame *frame = getFrame(_currentFrame);
+	if (!frame || id >= frame->_sprites.size()) {
 		warning("Score::getSpriteById(%d): out of bounds. frame: %d", id, _currentFrame);
 		return nullptr;
 	}
-	if (_frames[_currentFrame]->_sprites[id]) {
-		return _frames[_currentFrame]->_sprites[id];
+	if (frame->_sprites[id]) {
+		return frame->_sprites[id];
 	} else {
 		warning("Sprite on frame %d width id %d not found", _currentFrame, id);
 		return nullptr;
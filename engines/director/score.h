@@ -81,8 +81,11 @@ public:
 	uint16 getCurrentFrame() { return _currentFrame; }
 	Common::String getMacName() const { return _macName; }
 	Sprite *getSpriteById(uint16 id);
+	Frame *getFrame(uint16 frameId);
+	uint16 getFrameCount() const { return _frames.size(); }
 	void setSpriteCasts();
 	void loadSpriteImages(bool isSharedCast);
+	const Graphics::Surface *getBitmapSurface(int castId);
 	void copyCastStxts();
 	Graphics::ManagedSurface *getSurface() { return _surface; }
 
@@ -99,6 +102,12 @@ private:
 	void readVersion(uint32 rid);
 	void loadPalette(Common::SeekableSubReadStreamEndian &stream);
 	void loadFrames(Common::SeekableSubReadStreamEndian &stream);
+	Frame *decodeFrame(uint16 frameId);
+	void applyFrameDelta(byte *channelData, uint16 frameId) const;
+	void setSpriteCasts(Frame *frame);
+	Image::ImageDecoder *decodeBitmap(int castId, BitmapCast *bitmapCast);
+	void evictBitmaps(int keepCastId);
+	void flushBitmapCache();
 	void loadLabels(Common::SeekableSubReadStreamEndian &stream);
 	void loadActions(Common::SeekableSubReadStreamEndian &stream);
 	void loadScriptText(Common::SeekableSubReadStreamEndian &stream);
@@ -111,7 +120,6 @@ private:
 	bool processImmediateFrameScript(Common::String s, int id);
 
 public:
-	Common::Array<Frame *> _frames;
 	Common::HashMap<int, CastType> _castTypes;
 	Common::HashMap<uint16, CastInfo *> _castsInfo;
 	Common::HashMap<Common::String, int> _castsNames;
@@ -138,6 +146,37 @@ public:
 	Common::HashMap<int, const Stxt *> *_loadedStxts;
 
 private:
+	// Frames are materialised by getFrame() when playback reaches them.
+	// Until then only the channel deltas of each frame are kept, together
+	// with a snapshot of the whole channel data every kKeyframeInterval
+	// frames, so decoding a frame never replays more than a few deltas.
+	enum {
+		kKeyframeInterval = 32
+	};
+
+	Common::Array<Frame *> _frames;
+	Common::Array<byte> _frameDeltas;
+	Common::Array<uint32> _frameDeltaOffsets;
+	Common::Array<byte> _keyframes;
+	bool _frameDataBE;
+
+	// Cast bitmaps are decoded on first use and the least recently used
+	// ones are dropped again once the cache grows beyond kBitmapCacheSize
+	enum {
+		kBitmapCacheSize = 16 * 1024 * 1024
+	};
+
+	struct BitmapCacheEntry {
+		Image::ImageDecoder *decoder;
+		uint32 size;
+		uint32 lastUsed;
+	};
+
+	Common::HashMap<int, BitmapCacheEntry> _bitmapCache;
+	uint32 _bitmapCacheSize;
+	uint32 _bitmapCacheClock;
+	bool _isSharedCast;
+
 	uint16 _versionMinor;
 	uint16 _versionMajor;
 	Common::String _macName;
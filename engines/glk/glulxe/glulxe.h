@@ -158,6 +158,18 @@ private:
 	int undo_chain_num;
 	byte **undo_chain;
 
+	/**
+	 * For each undo level, the pages of RAM in which it differs from the next newer level.
+	 * The newest level has none, its RAM is kept in undo_ram.
+	 */
+	byte **undo_pages;
+
+	/**
+	 * A copy of RAM (ramstart to endmem) as it was at the newest undo level.
+	 */
+	byte *undo_ram;
+	uint undo_ram_len;
+
 	/**
 	 * This will contain a copy of RAM (ramstate to endmem) as it exists in the game file.
 	 */
@@ -356,6 +368,22 @@ protected:
 	uint write_heapstate_sub(uint sumlen, uint *sumarray, dest_t *dest, int portable);
 	static int sort_heap_summary(const void *p1, const void *p2);
 
+	/**
+	 * Write the pages in which undo_ram differs from the current RAM, in their undo_ram state.
+	 * If the size of RAM changed, all of undo_ram is written.
+	 */
+	uint write_undo_pages(dest_t *dest, uint memlen);
+
+	/**
+	 * Apply pages written by write_undo_pages() to undo_ram.
+	 */
+	uint read_undo_pages(byte *pages);
+
+	/**
+	 * Copy undo_ram back into RAM, except for the protected range.
+	 */
+	uint restore_undo_ram();
+
 	int read_byte(dest_t *dest, byte *val);
 	int read_short(dest_t *dest, uint16 *val);
 	int read_long(dest_t *dest, uint *val);
@@ -71,6 +71,11 @@ class Glulxe;
  */
 #define SERIALIZE_CACHE_RAM (1)
 
+/**
+ * Granularity in bytes with which older undo levels record the parts of RAM they differ in.
+ */
+#define UNDO_PAGE_SIZE (1024)
+
 /**
  * Some macros to read and write integers to memory, always in big-endian format.
  */
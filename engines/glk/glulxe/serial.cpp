@@ -33,6 +33,9 @@ bool Glulxe::init_serial() {
 	undo_chain = (unsigned char **)glulx_malloc(sizeof(unsigned char *) * undo_chain_size);
 	if (!undo_chain)
 		return false;
+	undo_pages = (unsigned char **)glulx_malloc(sizeof(unsigned char *) * undo_chain_size);
+	if (!undo_pages)
+		return false;
 
 #ifdef SERIALIZE_CACHE_RAM
 	{
@@ -57,13 +60,22 @@ void Glulxe::final_serial() {
 		int ix;
 		for (ix = 0; ix < undo_chain_num; ix++) {
 			glulx_free(undo_chain[ix]);
+			glulx_free(undo_pages[ix]);
 		}
 		glulx_free(undo_chain);
+		glulx_free(undo_pages);
 	}
 	undo_chain = nullptr;
+	undo_pages = nullptr;
 	undo_chain_size = 0;
 	undo_chain_num = 0;
 
+	if (undo_ram) {
+		glulx_free(undo_ram);
+		undo_ram = nullptr;
+	}
+	undo_ram_len = 0;
+
 #ifdef SERIALIZE_CACHE_RAM
 	if (ramcache) {
 		glulx_free(ramcache);
@@ -73,16 +85,22 @@ void Glulxe::final_serial() {
 }
 
 uint Glulxe::perform_saveundo() {
-	dest_t dest;
+	dest_t dest, pagedest;
 	uint res;
-	uint memstart = 0, memlen = 0, heapstart = 0, heaplen = 0;
+	uint memlen = endmem - ramstart;
+	uint heapstart = 0, heaplen = 0;
 	uint stackstart = 0, stacklen = 0;
 
 	/* The format for undo-saves is simpler than for saves on disk. We
-	   just have a memory chunk, a heap chunk, and a stack chunk, in
-	   that order. We skip the IFF chunk headers (although the size
-	   fields are still there.) We also don't bother with IFF's 16-bit
-	   alignment. */
+	   just have a heap chunk and a stack chunk, in that order. We skip
+	   the IFF chunk headers (although the size fields are still there.)
+	   We also don't bother with IFF's 16-bit alignment.
+
+	   Main memory is not part of the chunk. The newest undo level keeps
+	   a plain copy of RAM in undo_ram, and once a level stops being the
+	   newest one, only the pages in which it differs from its successor
+	   are stored in undo_pages. So a turn which touches little memory
+	   costs little, however large the game is. */
 
 	if (undo_chain_size == 0)
 		return 1;
@@ -93,18 +111,16 @@ uint Glulxe::perform_saveundo() {
 	dest.ptr = nullptr;
 	dest.str = nullptr;
 
+	pagedest.ismem = true;
+	pagedest.size = 0;
+	pagedest.pos = 0;
+	pagedest.ptr = nullptr;
+	pagedest.str = nullptr;
+
 	res = 0;
 	if (res == 0) {
 		res = write_long(&dest, 0); /* space for chunk length */
 	}
-	if (res == 0) {
-		memstart = dest.pos;
-		res = write_memstate(&dest);
-		memlen = dest.pos - memstart;
-	}
-	if (res == 0) {
-		res = write_long(&dest, 0); /* space for chunk length */
-	}
 	if (res == 0) {
 		heapstart = dest.pos;
 		res = write_heapstate(&dest, false);
@@ -125,12 +141,6 @@ uint Glulxe::perform_saveundo() {
 		if (!dest.ptr)
 			res = 1;
 	}
-	if (res == 0) {
-		res = reposition_write(&dest, memstart - 4);
-	}
-	if (res == 0) {
-		res = write_long(&dest, memlen);
-	}
 	if (res == 0) {
 		res = reposition_write(&dest, heapstart - 4);
 	}
@@ -144,25 +154,58 @@ uint Glulxe::perform_saveundo() {
 		res = write_long(&dest, stacklen);
 	}
 
+	if (res == 0 && undo_chain_num > 0 && undo_chain_size > 1) {
+		/* The current newest level is about to become the second one. */
+		res = write_undo_pages(&pagedest, memlen);
+	}
+
+	if (res == 0 && undo_ram_len != memlen) {
+		byte *newram = (byte *)glulx_realloc(undo_ram, memlen);
+		if (newram) {
+			undo_ram = newram;
+			undo_ram_len = memlen;
+		} else {
+			res = 1;
+		}
+	}
+
 	if (res == 0) {
 		/* It worked. */
+		memcpy(undo_ram, memmap + ramstart, memlen);
+
 		if (undo_chain_num >= undo_chain_size) {
 			glulx_free(undo_chain[undo_chain_num - 1]);
+			glulx_free(undo_pages[undo_chain_num - 1]);
 			undo_chain[undo_chain_num - 1] = nullptr;
+			undo_pages[undo_chain_num - 1] = nullptr;
 		}
-		if (undo_chain_size > 1)
+		if (undo_chain_size > 1) {
 			memmove(undo_chain + 1, undo_chain,
 			        (undo_chain_size - 1) * sizeof(unsigned char *));
+			memmove(undo_pages + 1, undo_pages,
+			        (undo_chain_size - 1) * sizeof(unsigned char *));
+			undo_pages[1] = pagedest.ptr;
+		}
 		undo_chain[0] = dest.ptr;
+		undo_pages[0] = nullptr;
 		if (undo_chain_num < undo_chain_size)
 			undo_chain_num += 1;
+
+		debug(2, "Undo level saved: %u bytes of state, %u bytes of changed RAM, %u bytes of RAM",
+		      dest.pos, pagedest.pos, memlen);
+
 		dest.ptr = nullptr;
+		pagedest.ptr = nullptr;
 	} else {
 		/* It didn't work. */
 		if (dest.ptr) {
 			glulx_free(dest.ptr);
 			dest.ptr = nullptr;
 		}
+		if (pagedest.ptr) {
+			glulx_free(pagedest.ptr);
+			pagedest.ptr = nullptr;
+		}
 	}
 
 	return res;
@@ -173,6 +216,7 @@ uint Glulxe::perform_restoreundo() {
 	uint res, val = 0;
 	uint heapsumlen = 0;
 	uint *heapsumarr = nullptr;
+	int ix;
 
 	/* If profiling is enabled and active then fail. */
 #if VM_PROFILING
@@ -191,10 +235,7 @@ uint Glulxe::perform_restoreundo() {
 
 	res = 0;
 	if (res == 0) {
-		res = read_long(&dest, &val);
-	}
-	if (res == 0) {
-		res = read_memstate(&dest, val);
+		res = restore_undo_ram();
 	}
 	if (res == 0) {
 		res = read_long(&dest, &val);
@@ -217,10 +258,29 @@ uint Glulxe::perform_restoreundo() {
 	}
 
 	if (res == 0) {
-		/* It worked. */
-		if (undo_chain_size > 1)
+		/* It worked. The next level becomes the newest one, so undo_ram
+		   has to be brought back to its state. If that fails, the older
+		   levels can't be rebuilt anymore and are dropped. */
+		if (undo_chain_num > 1 && read_undo_pages(undo_pages[1])) {
+			for (ix = 1; ix < undo_chain_num; ix++) {
+				glulx_free(undo_chain[ix]);
+				glulx_free(undo_pages[ix]);
+				undo_chain[ix] = nullptr;
+				undo_pages[ix] = nullptr;
+			}
+			undo_chain_num = 1;
+		}
+
+		if (undo_chain_num > 1) {
+			glulx_free(undo_pages[1]);
+			undo_pages[1] = nullptr;
+		}
+		if (undo_chain_size > 1) {
 			memmove(undo_chain, undo_chain + 1,
 			        (undo_chain_size - 1) * sizeof(unsigned char *));
+			memmove(undo_pages, undo_pages + 1,
+			        (undo_chain_size - 1) * sizeof(unsigned char *));
+		}
 		undo_chain_num -= 1;
 		glulx_free(dest.ptr);
 		dest.ptr = nullptr;
@@ -232,6 +292,105 @@ uint Glulxe::perform_restoreundo() {
 	return res;
 }
 
+uint Glulxe::write_undo_pages(dest_t *dest, uint memlen) {
+	uint res, pos, len, countpos, endpos;
+	uint count = 0;
+	bool full = (undo_ram_len != memlen);
+
+	res = write_long(dest, undo_ram_len);
+	if (res)
+		return res;
+
+	countpos = dest->pos;
+	res = write_long(dest, 0); /* space for page count */
+	if (res)
+		return res;
+
+	for (pos = 0; pos < undo_ram_len; pos += UNDO_PAGE_SIZE) {
+		len = MIN<uint>(UNDO_PAGE_SIZE, undo_ram_len - pos);
+		if (!full && !memcmp(undo_ram + pos, memmap + ramstart + pos, len))
+			continue;
+
+		res = write_long(dest, pos / UNDO_PAGE_SIZE);
+		if (res)
+			return res;
+		res = write_buffer(dest, undo_ram + pos, len);
+		if (res)
+			return res;
+		count++;
+	}
+
+	/* Trim it down to the perfect size. */
+	endpos = dest->pos;
+	dest->ptr = (byte *)glulx_realloc(dest->ptr, endpos);
+	if (!dest->ptr)
+		return 1;
+	dest->size = endpos;
+
+	res = reposition_write(dest, countpos);
+	if (res)
+		return res;
+	res = write_long(dest, count);
+	if (res)
+		return res;
+
+	return reposition_write(dest, endpos);
+}
+
+uint Glulxe::read_undo_pages(byte *pages) {
+	dest_t dest;
+	uint res, memlen, count, page, pos, len, ix;
+
+	dest.ismem = true;
+	dest.size = 0;
+	dest.pos = 0;
+	dest.ptr = pages;
+	dest.str = nullptr;
+
+	res = read_long(&dest, &memlen);
+	if (res == 0) {
+		res = read_long(&dest, &count);
+	}
+
+	if (res == 0 && memlen != undo_ram_len) {
+		/* All pages were stored in this case. */
+		byte *newram = (byte *)glulx_realloc(undo_ram, memlen);
+		if (!newram)
+			return 1;
+		undo_ram = newram;
+		undo_ram_len = memlen;
+	}
+
+	for (ix = 0; res == 0 && ix < count; ix++) {
+		res = read_long(&dest, &page);
+		if (res == 0) {
+			pos = page * UNDO_PAGE_SIZE;
+			len = MIN<uint>(UNDO_PAGE_SIZE, memlen - pos);
+			res = read_buffer(&dest, undo_ram + pos, len);
+		}
+	}
+
+	return res;
+}
+
+uint Glulxe::restore_undo_ram() {
+	uint res, protstart, protend;
+
+	heap_clear();
+
+	res = change_memsize(ramstart + undo_ram_len, false);
+	if (res)
+		return res;
+
+	protstart = CLIP(protectstart, ramstart, endmem);
+	protend = CLIP(protectend, protstart, endmem);
+
+	memcpy(memmap + ramstart, undo_ram, protstart - ramstart);
+	memcpy(memmap + protend, undo_ram + (protend - ramstart), endmem - protend);
+
+	return 0;
+}
+
 Common::Error Glulxe::saveGameData(strid_t str, const Common::String &desc) {
 	dest_t dest;
 	int ix;
@@ -493,7 +652,8 @@ int Glulxe::reposition_write(dest_t *dest, uint pos) {
 int Glulxe::write_buffer(dest_t *dest, const byte *ptr, uint len) {
 	if (dest->ismem) {
 		if (dest->pos + len > dest->size) {
-			dest->size = dest->pos + len + 1024;
+			/* Grow geometrically, memory states run into megabytes */
+			dest->size = MAX(dest->size * 2, dest->pos + len + 1024);
 			if (!dest->ptr) {
 				dest->ptr = (byte *)glulx_malloc(dest->size);
 			} else {
@@ -37,7 +37,7 @@ namespace Glk {
 
 
 TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : Window(windows, rock),
-		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
+		_font(g_conf->_propInfo), _reflowPending(false), _historyPos(0), _historyFirst(0), _historyPresent(0),
 		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
 		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
@@ -83,9 +83,12 @@ void TextBufferWindow::rearrange(const Rect &box) {
 	_yAdj = (box.height() - rnd);
 	_bbox.top += (box.height() - rnd);
 
+	// Reflowing is left to redraw(), so that a series of rearranges, such as
+	// while windows are being split or resized, only lays out the text once
 	if (newwid != _width) {
 		_width = newwid;
-		reflow();
+		_reflowPending = true;
+		_windows->repaint(_bbox);
 	}
 
 	if (newhgt != _height) {
@@ -119,19 +122,31 @@ void TextBufferWindow::reflow() {
 	Attributes curattr, oldattr;
 	int i, k, p, s;
 	int x;
+	int numChars, numPics;
+
+	_reflowPending = false;
 
 	if (_height < 4 || _width < 20)
 		return;
 
 	_lines[0]._len = _numChars;
 
+	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
+
+	// size the temp buffers to the text actually held
+	numChars = numPics = 0;
+	for (k = s; k >= 0; k--) {
+		numChars += _lines[k]._len + (_lines[k]._newLine ? 1 : 0);
+		numPics += (_lines[k]._lPic ? 1 : 0) + (_lines[k]._rPic ? 1 : 0);
+	}
+
 	// allocate temp buffers
-	Attributes *attrbuf = new Attributes[SCROLLBACK * TBLINELEN];
-	uint32 *charbuf = new uint32[SCROLLBACK * TBLINELEN];
-	int *alignbuf = new int[SCROLLBACK];
-	Picture **pictbuf = new Picture *[SCROLLBACK];
-	uint *hyperbuf = new uint[SCROLLBACK];
-	int *offsetbuf = new int[SCROLLBACK];
+	Attributes *attrbuf = new Attributes[numChars + 1];
+	uint32 *charbuf = new uint32[numChars + 1];
+	int *alignbuf = new int[numPics + 1];
+	Picture **pictbuf = new Picture *[numPics + 1];
+	uint *hyperbuf = new uint[numPics + 1];
+	int *offsetbuf = new int[numPics + 1];
 
 	if (!attrbuf || !charbuf || !alignbuf || !pictbuf || !hyperbuf || !offsetbuf) {
 		delete[] attrbuf;
@@ -150,7 +165,6 @@ void TextBufferWindow::reflow() {
 
 	x = 0;
 	p = 0;
-	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
 
 	for (k = s; k >= 0; k--) {
 		if (k == 0 && _lineRequest)
@@ -816,6 +830,9 @@ void TextBufferWindow::redraw() {
 	int tx, tsc, tsw, lsc, rsc;
 	Screen &screen = *g_vm->_screen;
 
+	if (_reflowPending)
+		reflow();
+
 	Window::redraw();
 
 	_lines[0]._len = _numChars;
@@ -1080,7 +1097,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1540,11 +1557,19 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// The oldest row drops out of the scrollback and is reused as row 0
+	TextBufferRow &oldest = _lines[_scrollBack - 1];
+	if (oldest._lPic)
+		oldest._lPic->decrement();
+	if (oldest._rPic)
+		oldest._rPic->decrement();
+
+	_lines.rotate();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
+
+	for (int i = 1; i < _height && i < _scrollBack; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1564,7 +1589,8 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._rPic = nullptr;
 	_lines[0]._lHyper = 0;
 	_lines[0]._rHyper = 0;
-	
+	_lines[0]._repaint = false;
+
 	Common::fill(_chars, _chars + TBLINELEN, ' ');
 	memset(_attrs, 0, TBLINELEN * sizeof(Attributes));
 
@@ -1577,7 +1603,6 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 void TextBufferWindow::scrollResize() {
 	int i;
 
-	_lines.clear();
 	_lines.resize(_scrollBack + SCROLLBACK);
 
 	_chars = _lines[0]._chars;
@@ -1634,6 +1659,22 @@ void TextBufferWindow::flowBreak() {
 
 /*--------------------------------------------------------------------------*/
 
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_head == 0) {
+		_rows.resize(newSize);
+		return;
+	}
+
+	// Unwind the ring so that row 0 is stored first again
+	Common::Array<TextBufferRow> rows;
+	rows.resize(newSize);
+	for (uint i = 0; i < newSize && i < _rows.size(); i++)
+		rows[i] = (*this)[i];
+
+	_rows = rows;
+	_head = 0;
+}
+
 TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(false),
 	_repaint(false), _lPic(nullptr), _rPic(nullptr), _lHyper(0), _rHyper(0),
 	_lm(0), _rm(0) {
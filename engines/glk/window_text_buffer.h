@@ -53,9 +53,50 @@ class TextBufferWindow : public Window, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * The rows of the window, with row 0 being the newest one. They are kept
+	 * as a ring, so that scrolling by a line doesn't move the whole scrollback
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _head;
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _head(0) {}
+
+		/**
+		 * Returns the number of rows
+		 */
+		uint size() const { return _rows.size(); }
+
+		/**
+		 * Changes the number of rows. Existing rows keep their position
+		 */
+		void resize(uint newSize);
+
+		/**
+		 * Turns the oldest row into row 0, moving all others one up
+		 */
+		void rotate() {
+			_head = (_head == 0 ? _rows.size() : _head) - 1;
+		}
+
+		TextBufferRow &operator[](uint idx) {
+			idx += _head;
+			return _rows[idx >= _rows.size() ? idx - _rows.size() : idx];
+		}
+		const TextBufferRow &operator[](uint idx) const {
+			idx += _head;
+			return _rows[idx >= _rows.size() ? idx - _rows.size() : idx];
+		}
+	};
 private:
 	PropFontInfo &_font;
+	bool _reflowPending;
 private:
 	void reflow();
 	void touchScroll();
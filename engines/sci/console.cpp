@@ -176,6 +176,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("map_instrument",		WRAP_METHOD(Console, cmdMapInstrument));
 	registerCmd("audio_list",		WRAP_METHOD(Console, cmdAudioList));
 	registerCmd("audio_dump",		WRAP_METHOD(Console, cmdAudioDump));
+	registerCmd("audio_benchmark",	WRAP_METHOD(Console, cmdAudioBenchmark));
 	// Script
 	registerCmd("addresses",			WRAP_METHOD(Console, cmdAddresses));
 	registerCmd("registers",			WRAP_METHOD(Console, cmdRegisters));
@@ -393,6 +394,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" map_instrument - Dynamically maps an MT-32 instrument to a GM instrument\n");
 	debugPrintf(" audio_list - Lists currently active digital audio samples (SCI2+)\n");
 	debugPrintf(" audio_dump - Dumps the requested audio resource as an uncompressed wave file (SCI2+)\n");
+	debugPrintf(" audio_benchmark - Times mixing of the maximum number of digital audio channels (SCI2+)\n");
 	debugPrintf("\n");
 	debugPrintf("Script:\n");
 	debugPrintf(" addresses - Provides information on how to pass addresses\n");
@@ -1422,6 +1424,30 @@ bool Console::cmdAudioList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdAudioBenchmark(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (!_engine->_audio32) {
+		debugPrintf("This SCI version does not have a software digital audio mixer\n");
+		return true;
+	}
+
+	int numIterations = 1000;
+	if (argc > 1) {
+		numIterations = atoi(argv[1]);
+		if (numIterations <= 0) {
+			debugPrintf("Usage: %s [<iterations>]\n", argv[0]);
+			return true;
+		}
+	}
+
+	_engine->_audio32->printMixBenchmark(this, numIterations);
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+
+	return true;
+}
+
 bool Console::cmdAudioDump(int argc, const char **argv) {
 #ifdef ENABLE_SCI32
 	if (argc != 2 && argc != 6) {
@@ -124,6 +124,122 @@ static void checkListPointer(SegManager *segMan, reg_t addr) {
 
 #endif
 
+/**
+ * Returns the index of the given list, building it from the node chain if
+ * it has not been built yet.
+ */
+static const Common::Array<ListIndexEntry> &getListIndex(SegManager *segMan, List *list) {
+	if (list->indexValid)
+		return list->index;
+
+	list->index.clear();
+	list->keyIndex.clear();
+	reg_t nodeRef = list->first;
+	while (!nodeRef.isNull()) {
+		Node *node = segMan->lookupNode(nodeRef);
+		if (!node)
+			break;
+
+		ListIndexEntry entry;
+		entry.node = nodeRef;
+		entry.key = node->key;
+		entry.value = node->value;
+		list->index.push_back(entry);
+
+		if (!list->keyIndex.contains(node->key))
+			list->keyIndex[node->key] = nodeRef;
+
+		nodeRef = node->succ;
+	}
+
+	list->indexValid = true;
+	return list->index;
+}
+
+/**
+ * Returns the position of the given node in the index of the given list, or
+ * -1 if it is not part of it.
+ */
+static int findListIndexPosition(const List *list, const reg_t nodeRef) {
+	for (uint i = 0; i < list->index.size(); ++i) {
+		if (list->index[i].node == nodeRef)
+			return i;
+	}
+
+	return -1;
+}
+
+/**
+ * Records a node which has been linked into the given list at the given
+ * position in list order.
+ */
+static void addToListIndex(List *list, const uint position, const reg_t nodeRef, const Node *node) {
+	if (!list->indexValid)
+		return;
+
+	ListIndexEntry entry;
+	entry.node = nodeRef;
+	entry.key = node->key;
+	entry.value = node->value;
+	list->index.insert_at(position, entry);
+
+	Common::HashMap<reg_t, reg_t, reg_t_Hash>::iterator it = list->keyIndex.find(node->key);
+	if (it == list->keyIndex.end()) {
+		list->keyIndex[node->key] = nodeRef;
+	} else if (position + 1 < list->index.size() && (int)position < findListIndexPosition(list, it->_value)) {
+		it->_value = nodeRef;
+	}
+}
+
+/**
+ * Records a node which has been linked into the given list right before
+ * (offset 0) or right after (offset 1) the given anchor node.
+ */
+static void insertIntoListIndex(List *list, const reg_t anchorRef, const uint offset, const reg_t nodeRef, const Node *node) {
+	if (!list->indexValid)
+		return;
+
+	const int position = findListIndexPosition(list, anchorRef);
+	if (position == -1) {
+		// The anchor belongs to some other list, so the index can no longer be
+		// kept in step with the node chain. Build it again when next needed.
+		list->indexValid = false;
+		list->index.clear();
+		list->keyIndex.clear();
+		return;
+	}
+
+	addToListIndex(list, position + offset, nodeRef, node);
+}
+
+/**
+ * Forgets a node which has been unlinked from the given list.
+ */
+static void removeFromListIndex(List *list, const reg_t nodeRef) {
+	if (!list->indexValid)
+		return;
+
+	const int position = findListIndexPosition(list, nodeRef);
+	if (position == -1)
+		return;
+
+	const reg_t key = list->index[position].key;
+	list->index.remove_at(position);
+
+	Common::HashMap<reg_t, reg_t, reg_t_Hash>::iterator it = list->keyIndex.find(key);
+	if (it != list->keyIndex.end() && it->_value == nodeRef) {
+		// Hand the key over to the next node carrying it, if there is one
+		uint i = position;
+		while (i < list->index.size() && list->index[i].key != key)
+			++i;
+
+		if (i < list->index.size())
+			it->_value = list->index[i].node;
+		else
+			list->keyIndex.erase(it);
+	}
+}
+
 reg_t kNewList(EngineState *s, int argc, reg_t *argv) {
 	reg_t listRef;
 	List *list = s->_segMan->allocateList(&listRef);
@@ -219,6 +335,8 @@ static void addToFront(EngineState *s, reg_t listRef, reg_t nodeRef) {
 		oldNode->pred = nodeRef;
 	}
 	list->first = nodeRef;
+
+	addToListIndex(list, 0, nodeRef, newNode);
 }
 
 static void addToEnd(EngineState *s, reg_t listRef, reg_t nodeRef) {
@@ -245,6 +363,8 @@ static void addToEnd(EngineState *s, reg_t listRef, reg_t nodeRef) {
 		old_n->succ = nodeRef;
 	}
 	list->last = nodeRef;
+
+	addToListIndex(list, list->index.size(), nodeRef, newNode);
 }
 
 reg_t kNextNode(EngineState *s, int argc, reg_t *argv) {
@@ -282,20 +402,30 @@ reg_t kNodeValue(EngineState *s, int argc, reg_t *argv) {
 	return n ? n->value : NULL_REG;
 }
 
-reg_t kAddToFront(EngineState *s, int argc, reg_t *argv) {
-	addToFront(s, argv[0], argv[1]);
+/**
+ * Sets the key of a node about to be added to a list, so that the list index
+ * records the node under its new key.
+ */
+static void setNewNodeKey(EngineState *s, reg_t nodeRef, reg_t key) {
+	Node *node = s->_segMan->lookupNode(nodeRef);
+	if (node)
+		node->key = key;
+}
 
+reg_t kAddToFront(EngineState *s, int argc, reg_t *argv) {
 	if (argc == 3)
-		s->_segMan->lookupNode(argv[1])->key = argv[2];
+		setNewNodeKey(s, argv[1], argv[2]);
+
+	addToFront(s, argv[0], argv[1]);
 
 	return s->r_acc;
 }
 
 reg_t kAddToEnd(EngineState *s, int argc, reg_t *argv) {
-	addToEnd(s, argv[0], argv[1]);
-
 	if (argc == 3)
-		s->_segMan->lookupNode(argv[1])->key = argv[2];
+		setNewNodeKey(s, argv[1], argv[2]);
+
+	addToEnd(s, argv[0], argv[1]);
 
 	return s->r_acc;
 }
@@ -335,6 +465,8 @@ reg_t kAddAfter(EngineState *s, int argc, reg_t *argv) {
 		else
 			s->_segMan->lookupNode(oldNext)->pred = argv[2];
 
+		insertIntoListIndex(list, argv[1], 1, argv[2], newNode);
+
 	} else {
 		addToFront(s, argv[0], argv[2]); // Set as initial list node
 	}
@@ -377,6 +509,8 @@ reg_t kAddBefore(EngineState *s, int argc, reg_t *argv) {
 		else
 			s->_segMan->lookupNode(oldPred)->succ = argv[2];
 
+		insertIntoListIndex(list, argv[1], 0, argv[2], newNode);
+
 	} else {
 		addToFront(s, argv[0], argv[2]); // Set as initial list node
 	}
@@ -385,7 +519,6 @@ reg_t kAddBefore(EngineState *s, int argc, reg_t *argv) {
 }
 
 reg_t kFindKey(EngineState *s, int argc, reg_t *argv) {
-	reg_t node_pos;
 	reg_t key = argv[1];
 	reg_t list_pos = argv[0];
 
@@ -395,19 +528,13 @@ reg_t kFindKey(EngineState *s, int argc, reg_t *argv) {
 	checkListPointer(s->_segMan, argv[0]);
 #endif
 
-	node_pos = s->_segMan->lookupList(list_pos)->first;
-
-	debugC(kDebugLevelNodes, "First node at %04x:%04x", PRINT_REG(node_pos));
+	List *list = s->_segMan->lookupList(list_pos);
+	getListIndex(s->_segMan, list);
 
-	while (!node_pos.isNull()) {
-		Node *n = s->_segMan->lookupNode(node_pos);
-		if (n->key == key) {
-			debugC(kDebugLevelNodes, " Found key at %04x:%04x", PRINT_REG(node_pos));
-			return node_pos;
-		}
-
-		node_pos = n->succ;
-		debugC(kDebugLevelNodes, "NextNode at %04x:%04x", PRINT_REG(node_pos));
+	Common::HashMap<reg_t, reg_t, reg_t_Hash>::const_iterator it = list->keyIndex.find(key);
+	if (it != list->keyIndex.end()) {
+		debugC(kDebugLevelNodes, " Found key at %04x:%04x", PRINT_REG(it->_value));
+		return it->_value;
 	}
 
 	debugC(kDebugLevelNodes, "Looking for key without success");
@@ -423,6 +550,8 @@ reg_t kDeleteKey(EngineState *s, int argc, reg_t *argv) {
 
 	Node *n = s->_segMan->lookupNode(node_pos);
 
+	removeFromListIndex(list, node_pos);
+
 #ifdef ENABLE_SCI32
 	for (int i = 1; i <= list->numRecursions; ++i) {
 		if (list->nextNodes[i] == node_pos) {
@@ -534,28 +663,20 @@ reg_t kListAt(EngineState *s, int argc, reg_t *argv) {
 	}
 
 	List *list = s->_segMan->lookupList(argv[0]);
-	reg_t curAddress = list->first;
 	if (list->first.isNull()) {
 		// Happens in Torin when examining Di's locket in chapter 3
 		return NULL_REG;
 	}
-	Node *curNode = s->_segMan->lookupNode(curAddress);
-	reg_t curObject = curNode->value;
-	int16 listIndex = argv[1].toUint16();
-	int curIndex = 0;
-
-	while (curIndex != listIndex) {
-		if (curNode->succ.isNull()) {	// end of the list?
-			return NULL_REG;
-		}
 
-		curAddress = curNode->succ;
-		curNode = s->_segMan->lookupNode(curAddress);
-		curObject = curNode->value;
+	const Common::Array<ListIndexEntry> &index = getListIndex(s->_segMan, list);
+	int16 listIndex = argv[1].toUint16();
 
-		curIndex++;
+	if (listIndex < 0 || listIndex >= (int)index.size()) {	// end of the list?
+		return NULL_REG;
 	}
 
+	reg_t curObject = index[listIndex].value;
+
 	// Update the virtual file selected in the character import screen of QFG4.
 	// For the SCI0-SCI1.1 version of this, check kDrawControl().
 	if (g_sci->inQfGImportRoom() && !strcmp(s->_segMan->getObjectName(curObject), "SelectorDText"))
@@ -566,20 +687,11 @@ reg_t kListAt(EngineState *s, int argc, reg_t *argv) {
 
 reg_t kListIndexOf(EngineState *s, int argc, reg_t *argv) {
 	List *list = s->_segMan->lookupList(argv[0]);
+	const Common::Array<ListIndexEntry> &index = getListIndex(s->_segMan, list);
 
-	reg_t curAddress = list->first;
-	Node *curNode = s->_segMan->lookupNode(curAddress);
-	reg_t curObject;
-	uint16 curIndex = 0;
-
-	while (curNode) {
-		curObject = curNode->value;
-		if (curObject == argv[1])
+	for (uint16 curIndex = 0; curIndex < index.size(); ++curIndex) {
+		if (index[curIndex].value == argv[1])
 			return make_reg(0, curIndex);
-
-		curAddress = curNode->succ;
-		curNode = s->_segMan->lookupNode(curAddress);
-		curIndex++;
 	}
 
 	return SIGNAL_REG;
@@ -46,6 +46,13 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// Scripts load the resources of a new room up front, so queue the
+	// resource to be decompressed while the engine would otherwise be idle
+	if (restype == kResourceTypeSound && getSciVersion() >= SCI_VERSION_1_1)
+		g_sci->getResMan()->prefetchResource(ResourceId(g_sci->_soundCmd->getSoundResourceType(resnr), resnr));
+	else
+		g_sci->getResMan()->prefetchResource(ResourceId(restype, resnr));
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
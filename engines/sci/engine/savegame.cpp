@@ -91,6 +91,13 @@ void syncWithSerializer(Common::Serializer &s, Class &obj) {
 void syncWithSerializer(Common::Serializer &s, List &obj) {
 	syncWithSerializer(s, obj.first);
 	syncWithSerializer(s, obj.last);
+
+	// The node index is not saved, it is rebuilt on demand after loading
+	if (s.isLoading()) {
+		obj.indexValid = false;
+		obj.index.clear();
+		obj.keyIndex.clear();
+	}
 }
 
 void syncWithSerializer(Common::Serializer &s, Node &obj) {
@@ -1340,6 +1347,9 @@ void gamestate_restore(EngineState *s, Common::SeekableReadStream *fh) {
 			g_sci->_gfxScreen->clearForRestoreGame();
 	}
 
+	// Resources queued for prefetching belong to the scene we are leaving
+	g_sci->getResMan()->clearPrefetchQueue();
+
 	s->reset(true);
 	s->saveLoadWithSerializer(ser);	// FIXME: Error handling?
 
@@ -23,6 +23,7 @@
 #ifndef SCI_ENGINE_SEGMENT_H
 #define SCI_ENGINE_SEGMENT_H
 
+#include "common/hashmap.h"
 #include "common/serializer.h"
 #include "common/str.h"
 #include "sci/engine/object.h"
@@ -200,10 +201,36 @@ struct Node {
 	reg_t value;
 }; /* List nodes */
 
+struct ListIndexEntry {
+	reg_t node;
+	reg_t key;
+	reg_t value;
+};
+
 struct List {
 	reg_t first;
 	reg_t last;
 
+	/**
+	 * The nodes of this list in list order, together with their keys and
+	 * values, used by kListAt and kListIndexOf so that lookups do not need to
+	 * walk the node chain. The index is built on demand and then updated in
+	 * place as nodes are added to and removed from the list. It is not saved.
+	 */
+	Common::Array<ListIndexEntry> index;
+
+	/**
+	 * The first node in list order carrying each key, used by kFindKey.
+	 * Valid whenever `index` is.
+	 */
+	Common::HashMap<reg_t, reg_t, reg_t_Hash> keyIndex;
+
+	/**
+	 * Whether `index` and `keyIndex` currently reflect the contents of the
+	 * list.
+	 */
+	bool indexValid;
+
 #ifdef ENABLE_SCI32
 	/**
 	 * The next node for each level of recursion during iteration over this list
@@ -215,9 +242,13 @@ struct List {
 	 * The current level of recursion of kListEachElementDo for this list.
 	 */
 	int numRecursions;
+#endif
 
-	List() : numRecursions(0) {}
+	List() : indexValid(false) {
+#ifdef ENABLE_SCI32
+		numRecursions = 0;
 #endif
+	}
 };
 
 struct Hunk {
@@ -186,6 +186,12 @@ static inline reg_t make_reg32(SegmentId segment, uint32 offset) {
 	return r;
 }
 
+struct reg_t_Hash {
+	uint operator()(const reg_t& x) const {
+		return (x.getSegment() << 3) ^ x.getOffset() ^ (x.getOffset() << 16);
+	}
+};
+
 #define PRINT_REG(r) (kSegmentMask) & (unsigned) (r).getSegment(), (unsigned) (r).getOffset()
 
 // Stack pointer type
@@ -29,6 +29,7 @@
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "common/system.h"
 #endif
 
 #include "sci/parser/vocabulary.h"
@@ -971,6 +972,7 @@ void ResourceManager::init() {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
+	_prefetchQueue.clear();
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
@@ -1191,6 +1193,56 @@ void ResourceManager::unlockResource(Resource *res) {
 	freeOldResources();
 }
 
+void ResourceManager::prefetchResource(ResourceId id) {
+	const Resource *res = testResource(id);
+	if (!res || res->_status != kResStatusNoMalloc) {
+		return;
+	}
+
+	for (Common::List<ResourceId>::const_iterator it = _prefetchQueue.begin(); it != _prefetchQueue.end(); ++it) {
+		if (*it == id) {
+			return;
+		}
+	}
+
+	_prefetchQueue.push_back(id);
+}
+
+bool ResourceManager::processPrefetchQueue(uint32 maxMillis) {
+	const uint32 endTime = g_system->getMillis() + maxMillis;
+
+	while (!_prefetchQueue.empty()) {
+		// A load cannot be interrupted, so only start one while there is
+		// still time left
+		if (g_system->getMillis() >= endTime) {
+			break;
+		}
+
+		// Prefetching into a full LRU cache would only evict resources which
+		// were themselves prefetched or used very recently
+		if (_memoryLRU >= _maxMemoryLRU) {
+			debugC(kDebugLevelResMan, 2, "[resMan] LRU full, dropping %d prefetch requests", _prefetchQueue.size());
+			_prefetchQueue.clear();
+			break;
+		}
+
+		const ResourceId id = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		Resource *res = testResource(id);
+		if (res && res->_status == kResStatusNoMalloc) {
+			loadResource(res);
+			if (res->_status == kResStatusAllocated) {
+				debugC(kDebugLevelResMan, 2, "[resMan] Prefetched %s", id.toString().c_str());
+				addToLRU(res);
+				freeOldResources();
+			}
+		}
+	}
+
+	return !_prefetchQueue.empty();
+}
+
 const char *ResourceManager::versionDescription(ResVersion version) const {
 	switch (version) {
 	case kResVersionUnknown:
@@ -366,6 +366,34 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Queues a resource to be loaded and decompressed into the LRU cache ahead
+	 * of the time when it is actually needed. Queued resources are loaded by
+	 * processPrefetchQueue. Requesting a queued resource with findResource
+	 * before it has been prefetched simply loads it immediately.
+	 * @param id	The resource to prefetch
+	 */
+	void prefetchResource(ResourceId id);
+
+	/**
+	 * Loads queued prefetch resources until the queue is empty, the LRU cache
+	 * is full, or the given amount of time has elapsed. No new load is started
+	 * once the time is up, but one which is already running is finished.
+	 * @param maxMillis	For how many milliseconds new loads may still be started
+	 * @return true if there are still resources waiting to be prefetched
+	 */
+	bool processPrefetchQueue(uint32 maxMillis);
+
+	/**
+	 * Returns true if there are resources waiting to be prefetched.
+	 */
+	bool hasPendingPrefetch() const { return !_prefetchQueue.empty(); }
+
+	/**
+	 * Discards all resources waiting to be prefetched.
+	 */
+	void clearPrefetchQueue() { _prefetchQueue.clear(); }
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -480,6 +508,7 @@ protected:
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	Common::List<ResourceId> _prefetchQueue; ///< Resources waiting to be loaded ahead of use
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
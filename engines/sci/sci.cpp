@@ -671,6 +671,7 @@ void SciEngine::runGame() {
 
 		if (_gamestate->abortScriptProcessing == kAbortRestartGame) {
 			_gamestate->_segMan->resetSegMan();
+			_resMan->clearPrefetchQueue();
 			initGame();
 			initStackBaseWithSelector(SELECTOR(play));
 			_guestAdditions->patchGameSaveRestore();
@@ -856,7 +857,15 @@ void SciEngine::sleep(uint32 msecs) {
 #endif
 		time = g_system->getMillis();
 		if (time + 10 < wakeUpTime) {
-			g_system->delayMillis(10);
+			// Use the time that would otherwise be spent idle to decompress
+			// resources which scripts have asked to be loaded. The queue is
+			// worked off in small slices that end well before wakeUpTime, so
+			// that a load is never started once it is time to wake up.
+			if (!_resMan->hasPendingPrefetch() || !_resMan->processPrefetchQueue(MIN<uint32>(10, wakeUpTime - time - 10))) {
+				const uint32 elapsed = g_system->getMillis() - time;
+				if (elapsed < 10)
+					g_system->delayMillis(10 - elapsed);
+			}
 		} else {
 			if (time < wakeUpTime)
 				g_system->delayMillis(wakeUpTime - time);
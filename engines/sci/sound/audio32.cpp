@@ -202,6 +202,74 @@ int Audio32::writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateCon
 	return samplePairsWritten << 1;
 }
 
+/**
+ * Mixes frames of source audio into a stereo target buffer. The arithmetic is
+ * identical to the mixing done by RateConverter, but the loop body has no
+ * data-dependent branches so that compilers can turn it into SIMD code.
+ */
+template <bool STEREO>
+static void mixFrames(Audio::st_sample_t *targetBuffer, const Audio::st_sample_t *sourceBuffer, const int numFrames, const int leftVolume, const int rightVolume) {
+#ifdef OUTPUT_UNSIGNED_AUDIO
+	for (int i = 0; i < numFrames; ++i) {
+		const int left = sourceBuffer[STEREO ? i * 2 : i];
+		const int right = sourceBuffer[STEREO ? i * 2 + 1 : i];
+		Audio::clampedAdd(targetBuffer[i * 2], left * leftVolume / Audio::Mixer::kMaxMixerVolume);
+		Audio::clampedAdd(targetBuffer[i * 2 + 1], right * rightVolume / Audio::Mixer::kMaxMixerVolume);
+	}
+#else
+	if (leftVolume == 0 && rightVolume == 0) {
+		return;
+	}
+
+	if (leftVolume == Audio::Mixer::kMaxMixerVolume && rightVolume == Audio::Mixer::kMaxMixerVolume) {
+		for (int i = 0; i < numFrames; ++i) {
+			const int left = targetBuffer[i * 2] + sourceBuffer[STEREO ? i * 2 : i];
+			const int right = targetBuffer[i * 2 + 1] + sourceBuffer[STEREO ? i * 2 + 1 : i];
+			targetBuffer[i * 2] = MIN<int>(MAX<int>(left, Audio::ST_SAMPLE_MIN), Audio::ST_SAMPLE_MAX);
+			targetBuffer[i * 2 + 1] = MIN<int>(MAX<int>(right, Audio::ST_SAMPLE_MIN), Audio::ST_SAMPLE_MAX);
+		}
+		return;
+	}
+
+	for (int i = 0; i < numFrames; ++i) {
+		const int left = targetBuffer[i * 2] + sourceBuffer[STEREO ? i * 2 : i] * leftVolume / Audio::Mixer::kMaxMixerVolume;
+		const int right = targetBuffer[i * 2 + 1] + sourceBuffer[STEREO ? i * 2 + 1 : i] * rightVolume / Audio::Mixer::kMaxMixerVolume;
+		targetBuffer[i * 2] = MIN<int>(MAX<int>(left, Audio::ST_SAMPLE_MIN), Audio::ST_SAMPLE_MAX);
+		targetBuffer[i * 2 + 1] = MIN<int>(MAX<int>(right, Audio::ST_SAMPLE_MIN), Audio::ST_SAMPLE_MAX);
+	}
+#endif
+}
+
+int Audio32::writeAudioDirect(Audio::AudioStream &sourceStream, Audio::st_sample_t *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume) {
+	const bool stereo = sourceStream.isStereo();
+	const int numSamplesToRead = stereo ? numSamples : (numSamples >> 1);
+	if ((int)_mixBuffer.size() < numSamplesToRead) {
+		_mixBuffer.resize(numSamplesToRead);
+	}
+
+	const int numSamplesRead = sourceStream.readBuffer(_mixBuffer.data(), numSamplesToRead);
+	if (numSamplesRead <= 0) {
+		return 0;
+	}
+
+	const int numFrames = stereo ? (numSamplesRead >> 1) : numSamplesRead;
+	if (stereo) {
+		mixFrames<true>(targetBuffer, _mixBuffer.data(), numFrames, leftVolume, rightVolume);
+	} else {
+		mixFrames<false>(targetBuffer, _mixBuffer.data(), numFrames, leftVolume, rightVolume);
+	}
+
+	return numFrames << 1;
+}
+
+int Audio32::writeChannelAudio(const AudioChannel &channel, Audio::st_sample_t *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume) {
+	if (channel.stream->getRate() == getRate()) {
+		return writeAudioDirect(*channel.stream, targetBuffer, numSamples, leftVolume, rightVolume);
+	}
+
+	return writeAudioInternal(*channel.stream, *channel.converter, targetBuffer, numSamples, leftVolume, rightVolume);
+}
+
 int16 Audio32::getNumChannelsToMix() const {
 	Common::StackLock lock(_mutex);
 	int16 numChannels = 0;
@@ -378,14 +446,9 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 				_monitoredBuffer.resize(numSamples);
 			}
 			memset(_monitoredBuffer.data(), 0, _monitoredBuffer.size() * sizeof(Audio::st_sample_t));
-			_numMonitoredSamples = writeAudioInternal(*channel.stream, *channel.converter, _monitoredBuffer.data(), numSamples, leftVolume, rightVolume);
+			_numMonitoredSamples = writeChannelAudio(channel, _monitoredBuffer.data(), numSamples, leftVolume, rightVolume);
 
-			Audio::st_sample_t *sourceBuffer = _monitoredBuffer.data();
-			Audio::st_sample_t *targetBuffer = buffer;
-			const Audio::st_sample_t *const end = _monitoredBuffer.data() + _numMonitoredSamples;
-			while (sourceBuffer != end) {
-				Audio::clampedAdd(*targetBuffer++, *sourceBuffer++);
-			}
+			mixFrames<true>(buffer, _monitoredBuffer.data(), _numMonitoredSamples >> 1, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume);
 
 			if (_numMonitoredSamples > maxSamplesWritten) {
 				maxSamplesWritten = _numMonitoredSamples;
@@ -401,7 +464,7 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 				leftVolume = rightVolume = 0;
 			}
 
-			const int channelSamplesWritten = writeAudioInternal(*channel.stream, *channel.converter, buffer, numSamples, leftVolume, rightVolume);
+			const int channelSamplesWritten = writeChannelAudio(channel, buffer, numSamples, leftVolume, rightVolume);
 			if (channelSamplesWritten > maxSamplesWritten) {
 				maxSamplesWritten = channelSamplesWritten;
 			}
@@ -1324,6 +1387,69 @@ void Audio32::kernelPanOff(const int argc, const reg_t *const argv) {
 #pragma mark -
 #pragma mark Debugging
 
+void Audio32::printMixBenchmark(Console *con, const int numIterations) {
+	enum {
+		kNumFrames = 1024,
+		kSourceSeconds = 1
+	};
+
+	const int numChannels = _channels.size();
+	const int rate = getRate();
+	const uint32 sourceSize = rate * kSourceSeconds * 2 * sizeof(int16);
+	byte *source = (byte *)malloc(sourceSize);
+	for (uint32 i = 0; i < sourceSize / sizeof(int16); ++i) {
+		WRITE_LE_UINT16(source + i * sizeof(int16), (uint16)(i * 37));
+	}
+
+	Common::Array<Audio::st_sample_t> convertedOutput(kNumFrames * 2);
+	Common::Array<Audio::st_sample_t> directOutput(kNumFrames * 2);
+	const byte flags = Audio::FLAG_16BITS | Audio::FLAG_STEREO | Audio::FLAG_LITTLE_ENDIAN;
+
+	uint32 elapsed[2];
+	for (int mode = 0; mode < 2; ++mode) {
+		const bool direct = (mode == 1);
+		Audio::st_sample_t *const output = direct ? directOutput.data() : convertedOutput.data();
+
+		Common::Array<Audio::AudioStream *> streams(numChannels);
+		Common::Array<Audio::RateConverter *> converters(numChannels);
+		for (int i = 0; i < numChannels; ++i) {
+			streams[i] = new MutableLoopAudioStream(Audio::makeRawStream(source, sourceSize, rate, flags, DisposeAfterUse::NO), true);
+			converters[i] = Audio::makeRateConverter(rate, rate, true, false);
+		}
+
+		const uint32 startTime = g_system->getMillis();
+		for (int iteration = 0; iteration < numIterations; ++iteration) {
+			// Only lock per iteration, for the shared mix buffer, so that the
+			// mixer thread is not starved while the benchmark runs
+			Common::StackLock lock(_mutex);
+			memset(output, 0, kNumFrames * 2 * sizeof(Audio::st_sample_t));
+			for (int i = 0; i < numChannels; ++i) {
+				const Audio::st_volume_t leftVolume = Audio::Mixer::kMaxChannelVolume - i * 16;
+				const Audio::st_volume_t rightVolume = Audio::Mixer::kMaxChannelVolume >> (i % 3);
+				if (direct) {
+					writeAudioDirect(*streams[i], output, kNumFrames * 2, leftVolume, rightVolume);
+				} else {
+					writeAudioInternal(*streams[i], *converters[i], output, kNumFrames * 2, leftVolume, rightVolume);
+				}
+			}
+		}
+		elapsed[mode] = g_system->getMillis() - startTime;
+
+		for (int i = 0; i < numChannels; ++i) {
+			delete converters[i];
+			delete streams[i];
+		}
+	}
+
+	free(source);
+
+	const bool identical = !memcmp(convertedOutput.data(), directOutput.data(), kNumFrames * 2 * sizeof(Audio::st_sample_t));
+	con->debugPrintf("Mixed %d channels x %d frames, %d iterations at %d Hz\n", numChannels, kNumFrames, numIterations, rate);
+	con->debugPrintf("  rate converter: %u ms\n", elapsed[0]);
+	con->debugPrintf("  direct:         %u ms\n", elapsed[1]);
+	con->debugPrintf("  outputs %s\n", identical ? "match" : "DIFFER");
+}
+
 void Audio32::printAudioList(Console *con) const {
 	Common::StackLock lock(_mutex);
 	for (int i = 0; i < _numActiveChannels; ++i) {
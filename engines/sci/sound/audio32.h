@@ -220,6 +220,24 @@ private:
 	 */
 	int writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateConverter &converter, Audio::st_sample_t *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume);
 
+	/**
+	 * Mixes audio from the given source stream into the target buffer without
+	 * a rate converter. The source stream must already be at the output rate.
+	 */
+	int writeAudioDirect(Audio::AudioStream &sourceStream, Audio::st_sample_t *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume);
+
+	/**
+	 * Mixes audio from the given channel into the target buffer, using direct
+	 * mixing when possible and the channel's rate converter otherwise.
+	 */
+	int writeChannelAudio(const AudioChannel &channel, Audio::st_sample_t *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume);
+
+	/**
+	 * Scratch buffer used to read source audio for direct mixing. It is shared
+	 * by all channels.
+	 */
+	Common::Array<Audio::st_sample_t> _mixBuffer;
+
 #pragma mark -
 #pragma mark Channel management
 public:
@@ -652,6 +670,13 @@ public:
 #pragma mark Debugging
 public:
 	void printAudioList(Console *con) const;
+
+	/**
+	 * Mixes the maximum number of channels supported by this version of SCI
+	 * from synthetic audio, once through the rate converter path and once
+	 * through the direct mixing path, and prints the time taken by each.
+	 */
+	void printMixBenchmark(Console *con, const int numIterations);
 };
 
 } // End of namespace Sci
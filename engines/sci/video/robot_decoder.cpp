@@ -351,7 +351,9 @@ RobotDecoder::RobotDecoder(SegManager *segMan) :
 	_segMan(segMan),
 	_status(kRobotStatusUninitialized),
 	_audioBuffer(nullptr),
-	_rawPalette((uint8 *)malloc(kRawPaletteSize)) {}
+	_rawPalette((uint8 *)malloc(kRawPaletteSize)),
+	_readAheadStartFrameNo(-1),
+	_readAheadEndFrameNo(-1) {}
 
 RobotDecoder::~RobotDecoder() {
 	close();
@@ -467,10 +469,9 @@ void RobotDecoder::initVideo(const int16 x, const int16 y, const int16 scale, co
 }
 
 void RobotDecoder::initRecordAndCuePositions() {
-	PositionList recordSizes;
 	_videoSizes.reserve(_numFramesTotal);
 	_recordPositions.reserve(_numFramesTotal);
-	recordSizes.reserve(_numFramesTotal);
+	_recordSizes.reserve(_numFramesTotal);
 
 	switch(_version) {
 	case 5: // 16-bit sizes and positions
@@ -478,7 +479,7 @@ void RobotDecoder::initRecordAndCuePositions() {
 			_videoSizes.push_back(_stream->readUint16());
 		}
 		for (int i = 0; i < _numFramesTotal; ++i) {
-			recordSizes.push_back(_stream->readUint16());
+			_recordSizes.push_back(_stream->readUint16());
 		}
 		break;
 	case 6: // 32-bit sizes and positions
@@ -486,7 +487,7 @@ void RobotDecoder::initRecordAndCuePositions() {
 			_videoSizes.push_back(_stream->readSint32());
 		}
 		for (int i = 0; i < _numFramesTotal; ++i) {
-			recordSizes.push_back(_stream->readSint32());
+			_recordSizes.push_back(_stream->readSint32());
 		}
 		break;
 	default:
@@ -511,7 +512,7 @@ void RobotDecoder::initRecordAndCuePositions() {
 	int position = _stream->pos();
 	_recordPositions.push_back(position);
 	for (int i = 0; i < _numFramesTotal - 1; ++i) {
-		position += recordSizes[i];
+		position += _recordSizes[i];
 		_recordPositions.push_back(position);
 	}
 }
@@ -610,8 +611,10 @@ void RobotDecoder::close() {
 	_status = kRobotStatusUninitialized;
 	_videoSizes.clear();
 	_recordPositions.clear();
+	_recordSizes.clear();
 	_celDecompressionBuffer.clear();
-	_doVersion5Scratch.clear();
+	_readAheadBuffer.clear();
+	_readAheadStartFrameNo = _readAheadEndFrameNo = -1;
 	delete _stream;
 	_stream = nullptr;
 }
@@ -670,7 +673,6 @@ void RobotDecoder::showFrame(const uint16 frameNo, const uint16 newX, const uint
 	pause();
 
 	if (frameNo != _previousFrameNo) {
-		seekToFrame(frameNo);
 		doVersion5(false);
 	} else {
 		for (RobotScreenItemList::size_type i = 0; i < _screenItemList.size(); ++i) {
@@ -785,10 +787,6 @@ RobotDecoder::RobotStatus RobotDecoder::getStatus() const {
 	return _status;
 }
 
-bool RobotDecoder::seekToFrame(const int frameNo) {
-	return _stream->seek(_recordPositions[frameNo], SEEK_SET);
-}
-
 void RobotDecoder::setRobotTime(const int frameNo) {
 	_startTime = getTickCount();
 	_startFrameNo = frameNo;
@@ -1125,14 +1123,20 @@ bool RobotDecoder::readPrimerData(byte *outEvenBuffer, byte *outOddBuffer) {
 }
 
 bool RobotDecoder::readAudioDataFromRecord(const int frameNo, byte *outBuffer, int &outAudioPosition, int &outAudioSize) {
-	_stream->seek(_recordPositions[frameNo] + _videoSizes[frameNo], SEEK_SET);
+	const byte *record = getRecordData(frameNo);
 	_audioList.submitDriverMax();
 
+	if (record == nullptr || _videoSizes[frameNo] + kAudioBlockHeaderSize > _recordSizes[frameNo]) {
+		return false;
+	}
+
+	const byte *audioHeader = record + _videoSizes[frameNo];
+
 	// Compressed absolute position of the audio block in the audio stream
-	const int position = _stream->readSint32();
+	const int position = _stream->isBE() ? READ_BE_INT32(audioHeader) : READ_LE_INT32(audioHeader);
 
 	// Size of the block of audio, excluding the audio block header
-	int size = _stream->readSint32();
+	int size = _stream->isBE() ? READ_BE_INT32(audioHeader + 4) : READ_LE_INT32(audioHeader + 4);
 
 	assert(size <= _expectedAudioBlockSize);
 
@@ -1140,17 +1144,60 @@ bool RobotDecoder::readAudioDataFromRecord(const int frameNo, byte *outBuffer, i
 		return false;
 	}
 
+	if (_videoSizes[frameNo] + kAudioBlockHeaderSize + size > _recordSizes[frameNo]) {
+		return false;
+	}
+
+	const byte *audioData = audioHeader + kAudioBlockHeaderSize;
 	if (size != _expectedAudioBlockSize) {
 		memset(outBuffer, 0, kRobotZeroCompressSize);
-		_stream->read(outBuffer + kRobotZeroCompressSize, size);
+		memcpy(outBuffer + kRobotZeroCompressSize, audioData, size);
 		size += kRobotZeroCompressSize;
 	} else {
-		_stream->read(outBuffer, size);
+		memcpy(outBuffer, audioData, size);
 	}
 
 	outAudioPosition = position;
 	outAudioSize = size;
-	return !_stream->err();
+	return true;
+}
+
+void RobotDecoder::readAhead(const int frameNo) {
+	if (frameNo < 0 || frameNo >= _numFramesTotal ||
+		(frameNo >= _readAheadStartFrameNo && frameNo < _readAheadEndFrameNo)) {
+		return;
+	}
+
+	const int startPosition = _recordPositions[frameNo];
+	int endFrameNo = frameNo + 1;
+	while (endFrameNo < _numFramesTotal &&
+		   endFrameNo - frameNo < kReadAheadFrames &&
+		   _recordPositions[endFrameNo] + _recordSizes[endFrameNo] - startPosition <= kReadAheadSize) {
+		++endFrameNo;
+	}
+
+	const int lastFrameNo = endFrameNo - 1;
+	const int size = _recordPositions[lastFrameNo] + _recordSizes[lastFrameNo] - startPosition;
+	_readAheadBuffer.resize(size);
+
+	_stream->seek(startPosition, SEEK_SET);
+	if (_stream->read(_readAheadBuffer.begin(), size) != (uint32)size) {
+		_readAheadStartFrameNo = _readAheadEndFrameNo = -1;
+		return;
+	}
+
+	_readAheadStartFrameNo = frameNo;
+	_readAheadEndFrameNo = endFrameNo;
+}
+
+const byte *RobotDecoder::getRecordData(const int frameNo) {
+	readAhead(frameNo);
+
+	if (frameNo < _readAheadStartFrameNo || frameNo >= _readAheadEndFrameNo) {
+		return nullptr;
+	}
+
+	return _readAheadBuffer.begin() + _recordPositions[frameNo] - _recordPositions[_readAheadStartFrameNo];
 }
 
 bool RobotDecoder::readPartialAudioRecordAndSubmit(const int startFrame, const int startPosition) {
@@ -1236,7 +1283,6 @@ void RobotDecoder::doRobot() {
 	}
 
 	_delayTime.startTiming();
-	seekToFrame(_currentFrameNo);
 	doVersion5();
 	if (_hasAudio) {
 		_audioList.submitDriverMax();
@@ -1280,6 +1326,10 @@ void RobotDecoder::frameNowVisible() {
 		_previousFrameNo = _currentFrameNo;
 	}
 
+	// The frame is now on screen, so this is the least disruptive time to
+	// fetch the records of the frames that will be shown next
+	readAhead(_currentFrameNo + 1);
+
 	if (!_syncFrame && _hasAudio && getTickCount() >= _checkAudioSyncTime) {
 		RobotAudioStream::StreamState status;
 		const bool success = g_sci->_audio32->queryRobotAudio(status);
@@ -1357,12 +1407,9 @@ void RobotDecoder::setPriority(const int16 newPriority) {
 
 void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 	const RobotScreenItemList::size_type oldScreenItemCount = _screenItemList.size();
-	const int videoSize = _videoSizes[_currentFrameNo];
-	_doVersion5Scratch.resize(videoSize);
-
-	byte *videoFrameData = _doVersion5Scratch.begin();
 
-	if (!_stream->read(videoFrameData, videoSize)) {
+	const byte *videoFrameData = getRecordData(_currentFrameNo);
+	if (videoFrameData == nullptr || _videoSizes[_currentFrameNo] > _recordSizes[_currentFrameNo]) {
 		error("RobotDecoder::doVersion5: Read error");
 	}
 
@@ -528,6 +528,17 @@ private:
 		 */
 		kRobotFrameSize        = 2048,
 
+		/**
+		 * The maximum number of frame records to read ahead in one read.
+		 */
+		kReadAheadFrames       = 10,
+
+		/**
+		 * The maximum number of bytes to read ahead in one read. At least one
+		 * record is always read, regardless of its size.
+		 */
+		kReadAheadSize         = 512 * 1024,
+
 		/**
 		 * The size of a block of zero-compressed audio. Used to fill audio when
 		 * the size of an audio packet does not match the expected packet size.
@@ -659,6 +670,12 @@ private:
 	 */
 	PositionList _recordPositions;
 
+	/**
+	 * A map of frame numbers to the total size, in bytes, of each frame's
+	 * record within `_stream`.
+	 */
+	PositionList _recordSizes;
+
 	/**
 	 * The offset of the Robot file within a resource bundle.
 	 */
@@ -733,11 +750,6 @@ private:
 	 */
 	int32 _startingFrameNo;
 
-	/**
-	 * Seeks the raw data stream to the record for the given frame number.
-	 */
-	bool seekToFrame(const int frameNo);
-
 	/**
 	 * Sets the start time and frame of the robot when the robot is started or
 	 * resumed.
@@ -1315,10 +1327,37 @@ private:
 	bool _syncFrame;
 
 	/**
-	 * Scratch memory used to store the compressed robot video data for the
-	 * current frame.
+	 * Raw, still compressed, records of the frames from
+	 * `_readAheadStartFrameNo` up to but not including `_readAheadEndFrameNo`.
+	 * Records are stored contiguously in the robot file, so they are read
+	 * with a single sequential read instead of separate seeks and reads for
+	 * the video and audio parts of every frame.
+	 */
+	ScratchMemory _readAheadBuffer;
+
+	/**
+	 * The first frame held in the read-ahead buffer, or -1 if the buffer is
+	 * empty.
+	 */
+	int _readAheadStartFrameNo;
+
+	/**
+	 * The frame after the last frame held in the read-ahead buffer.
+	 */
+	int _readAheadEndFrameNo;
+
+	/**
+	 * Fills the read-ahead buffer with the records starting at the given
+	 * frame, unless that frame is already in the buffer.
+	 */
+	void readAhead(const int frameNo);
+
+	/**
+	 * Gets the raw record data for the given frame from the read-ahead
+	 * buffer, reading it from the stream first if necessary. Returns null if
+	 * the record could not be read.
 	 */
-	ScratchMemory _doVersion5Scratch;
+	const byte *getRecordData(const int frameNo);
 
 	/**
 	 * When set to a non-negative value, forces the next call to doRobot to
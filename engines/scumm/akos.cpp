@@ -539,12 +539,39 @@ byte AkosRenderer::drawLimb(const Actor *a, int limb) {
 	return result;
 }
 
+void AkosRenderer::codec1_drawPixel(byte *dst, uint16 color) {
+	uint16 pcolor = _palette[color];
+	if (_shadow_mode == 1) {
+		if (pcolor == 13)
+			pcolor = _shadow_table[*dst];
+	} else if (_shadow_mode == 2) {
+		error("codec1_spec2"); // TODO
+	} else if (_shadow_mode == 3) {
+		if (_vm->_game.features & GF_16BIT_COLOR) {
+			uint16 srcColor = (pcolor >> 1) & 0x7DEF;
+			uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
+			pcolor = srcColor + dstColor;
+		} else if (_vm->_game.heversion >= 90) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = xmap[pcolor];
+		} else if (pcolor < 8) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = _shadow_table[pcolor];
+		}
+	}
+	if (_vm->_bytesPerPixel == 2) {
+		WRITE_UINT16(dst, pcolor);
+	} else {
+		*dst = pcolor;
+	}
+}
+
 void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
 	byte len, maskbit;
 	int y;
-	uint16 color, height, pcolor;
+	uint16 color, height;
 	const byte *scaleytab;
 	bool masked;
 	bool skip_column = false;
@@ -580,32 +607,8 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 				} else {
 					masked = (y < v1.boundsRect.top || y >= v1.boundsRect.bottom) || (v1.x < 0 || v1.x >= v1.boundsRect.right) || (*mask & maskbit);
 
-					if (color && !masked && !skip_column) {
-						pcolor = _palette[color];
-						if (_shadow_mode == 1) {
-							if (pcolor == 13)
-								pcolor = _shadow_table[*dst];
-						} else if (_shadow_mode == 2) {
-							error("codec1_spec2"); // TODO
-						} else if (_shadow_mode == 3) {
-							if (_vm->_game.features & GF_16BIT_COLOR) {
-								uint16 srcColor = (pcolor >> 1) & 0x7DEF;
-								uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
-								pcolor = srcColor + dstColor;
-							} else if (_vm->_game.heversion >= 90) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = xmap[pcolor];
-							} else if (pcolor < 8) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = _shadow_table[pcolor];
-							}
-						}
-						if (_vm->_bytesPerPixel == 2) {
-							WRITE_UINT16(dst, pcolor);
-						} else {
-							*dst = pcolor;
-						}
-					}
+					if (color && !masked && !skip_column)
+						codec1_drawPixel(dst, color);
 				}
 				dst += _out.pitch;
 				mask += _numStrips;
@@ -637,6 +640,95 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	} while (1);
 }
 
+/**
+ * Variant of codec1_genericDecode() for cels which are not scaled vertically.
+ * Without vertical scaling every source pixel maps to exactly one output row,
+ * so each RLE run can be handled as a whole: transparent runs (and runs in
+ * columns which are skipped by horizontal scaling) just advance the output
+ * pointers, and only opaque runs are walked pixel by pixel for masking.
+ * The output is identical to the generic decoder.
+ */
+void AkosRenderer::codec1_spanDecode(Codec1 &v1) {
+	const byte *mask, *src;
+	byte *dst;
+	byte maskbit;
+	int y, len, height, n;
+	byte color;
+	bool skip_column = false;
+	bool columnVisible;
+
+	const int pitch = _out.pitch;
+	const int top = v1.boundsRect.top;
+	const int bottom = v1.boundsRect.bottom;
+
+	y = v1.y;
+	src = _srcptr;
+	dst = v1.destptr;
+	color = v1.repcolor;
+	height = _height;
+
+	// A pending run left over by codec1_ignorePakCols() has already had its
+	// current pixel consumed.
+	len = v1.replen ? v1.replen - 1 : 0;
+
+	maskbit = revBitMask(v1.x & 7);
+	mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), v1.y, _zbuf);
+	columnVisible = (v1.x >= 0 && v1.x < v1.boundsRect.right);
+
+	do {
+		if (!len) {
+			len = *src++;
+			color = len >> v1.shr;
+			len &= v1.mask;
+			if (!len) {
+				len = *src++;
+				// A zero length byte wraps around to a full run
+				if (!len)
+					len = 256;
+			}
+		}
+
+		n = MIN(len, height);
+		len -= n;
+		height -= n;
+
+		if (color && columnVisible && !skip_column) {
+			while (n--) {
+				if (y >= top && y < bottom && !(*mask & maskbit))
+					codec1_drawPixel(dst, color);
+				dst += pitch;
+				mask += _numStrips;
+				y++;
+			}
+		} else {
+			dst += n * pitch;
+			mask += n * _numStrips;
+			y += n;
+		}
+
+		if (!height) {
+			if (!--v1.skip_width)
+				return;
+			height = _height;
+			y = v1.y;
+
+			if (_scaleX == 255 || v1.scaletable[v1.scaleXindex] < _scaleX) {
+				v1.x += v1.scaleXstep;
+				if (v1.x < 0 || v1.x >= v1.boundsRect.right)
+					return;
+				maskbit = revBitMask(v1.x & 7);
+				v1.destptr += v1.scaleXstep * _vm->_bytesPerPixel;
+				skip_column = false;
+			} else
+				skip_column = true;
+			v1.scaleXindex += v1.scaleXstep;
+			dst = v1.destptr;
+			mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), v1.y, _zbuf);
+			columnVisible = true;
+		}
+	} while (1);
+}
+
 // This is exact duplicate of smallCostumeScaleTable[] in costume.cpp
 // See FIXME below for explanation
 const byte smallCostumeScaleTableAKOS[256] = {
@@ -996,7 +1088,10 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.destptr = (byte *)_out.getBasePtr(v1.x, v1.y);
 
-	codec1_genericDecode(v1);
+	if (_scaleY == 255 && !_actorHitMode)
+		codec1_spanDecode(v1);
+	else
+		codec1_genericDecode(v1);
 
 	return drawFlag;
 }
@@ -87,6 +87,7 @@ struct Box {				/* Internal walkbox file format */
 
 
 static void getGates(const BoxCoords &box1, const BoxCoords &box2, Common::Point gateA[2], Common::Point gateB[2]);
+static bool boxesTouch(BoxCoords box2, BoxCoords box);
 
 static bool compareSlope(const Common::Point &p1, const Common::Point &p2, const Common::Point &p3) {
 	return (p2.y - p1.y) * (p3.x - p1.x) <= (p3.y - p1.y) * (p2.x - p1.x);
@@ -571,7 +572,48 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 	return true;
 }
 
+void ScummEngine::invalidateBoxCache() {
+	_boxCoordsCache.clear();
+	_boxNeighborCache.clear();
+	_boxMatrixInvisible.clear();
+}
+
+/**
+ * Make sure the box coordinate and neighbor caches reflect the current box
+ * set. Returns false if there is nothing to cache.
+ */
+bool ScummEngine::updateBoxCache() {
+	if (!_boxCoordsCache.empty())
+		return true;
+
+	if (_game.version < 3)
+		return false;
+
+	const int num = getNumBoxes();
+	if (num == 0)
+		return false;
+
+	_boxCoordsCache.resize(num);
+	for (int i = 0; i < num; i++)
+		_boxCoordsCache[i] = readBoxCoordinates(i);
+
+	_boxNeighborCache.resize(num * num);
+	for (int i = 0; i < num; i++) {
+		for (int j = 0; j < num; j++)
+			_boxNeighborCache[i * num + j] = (i != j) && boxesTouch(_boxCoordsCache[i], _boxCoordsCache[j]);
+	}
+
+	return true;
+}
+
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	if (updateBoxCache() && boxnum >= 0 && boxnum < (int)_boxCoordsCache.size())
+		return _boxCoordsCache[boxnum];
+
+	return readBoxCoordinates(boxnum);
+}
+
+BoxCoords ScummEngine::readBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -1025,6 +1067,22 @@ void ScummEngine::createBoxMatrix() {
 	// The total number of boxes
 	num = getNumBoxes();
 
+	// The box matrix only depends on the box geometry, which doesn't change
+	// within a box set, and on which boxes are invisible. Scripts often call
+	// this after changing flags that have no influence on either, in which
+	// case there is nothing to do.
+	if (_game.version >= 3) {
+		Common::Array<bool> invisible;
+		invisible.resize(num);
+		for (i = 0; i < num; i++)
+			invisible[i] = (getBoxFlags(i) & kBoxInvisible) != 0;
+
+		if (!_boxMatrixInvisible.empty() && invisible == _boxMatrixInvisible && _res->isResourceLoaded(rtMatrix, 1))
+			return;
+
+		_boxMatrixInvisible = invisible;
+	}
+
 	const uint8 boxSize = (_game.version == 0) ? num : 64;
 
 	// calculate shortest paths
@@ -1076,16 +1134,22 @@ void ScummEngine::createBoxMatrix() {
 
 /** Check if two boxes are neighbors. */
 bool ScummEngine::areBoxesNeighbors(int box1nr, int box2nr) {
-	Common::Point tmp;
-	BoxCoords box;
-	BoxCoords box2;
-
 	if ((getBoxFlags(box1nr) & kBoxInvisible) || (getBoxFlags(box2nr) & kBoxInvisible))
 		return false;
 
 	assert(_game.version >= 3);
-	box2 = getBoxCoordinates(box1nr);
-	box = getBoxCoordinates(box2nr);
+	if (updateBoxCache()) {
+		const int num = _boxCoordsCache.size();
+		if (box1nr < num && box2nr < num)
+			return _boxNeighborCache[box1nr * num + box2nr];
+	}
+
+	return boxesTouch(getBoxCoordinates(box1nr), getBoxCoordinates(box2nr));
+}
+
+/** Check if two boxes share (part of) a side, disregarding their flags. */
+static bool boxesTouch(BoxCoords box2, BoxCoords box) {
+	Common::Point tmp;
 
 	// Roughly, the idea of this algorithm is to search for sies of the given
 	// boxes that touch each other.
@@ -459,6 +459,11 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	}
 #endif /* USE_ARM_COSTUME_ASM */
 
+	if (_scaleY == 255) {
+		proc3_span(v1);
+		return;
+	}
+
 	y = v1.y;
 	src = _srcptr;
 	dst = v1.destptr;
@@ -522,6 +527,93 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	} while (1);
 }
 
+/**
+ * Variant of proc3() for cels which are not scaled vertically, handling each
+ * RLE run as a whole instead of pixel by pixel: transparent runs only advance
+ * the output pointers. The output is identical to proc3().
+ */
+void ClassicCostumeRenderer::proc3_span(Codec1 &v1) {
+	const byte *mask, *src;
+	byte *dst;
+	byte maskbit;
+	int y, len, height, n;
+	uint color, pcolor;
+	bool columnVisible;
+
+	y = v1.y;
+	src = _srcptr;
+	dst = v1.destptr;
+	color = v1.repcolor;
+	height = _height;
+
+	// A pending run left over by codec1_ignorePakCols() has already had its
+	// current pixel consumed.
+	len = v1.replen ? v1.replen - 1 : 0;
+
+	maskbit = revBitMask(v1.x & 7);
+	mask = v1.mask_ptr + v1.x / 8;
+	columnVisible = (v1.x >= 0 && v1.x < _out.w);
+
+	do {
+		if (!len) {
+			len = *src++;
+			color = len >> v1.shr;
+			len &= v1.mask;
+			if (!len) {
+				len = *src++;
+				// A zero length byte wraps around to a full run
+				if (!len)
+					len = 256;
+			}
+		}
+
+		n = MIN(len, height);
+		len -= n;
+		height -= n;
+
+		if (color && columnVisible) {
+			while (n--) {
+				if (y >= 0 && y < _out.h && !(v1.mask_ptr && (mask[0] & maskbit))) {
+					if (_shadow_mode & 0x20) {
+						pcolor = _shadow_table[*dst];
+					} else {
+						pcolor = _palette[color];
+						if (pcolor == 13 && _shadow_table)
+							pcolor = _shadow_table[*dst];
+					}
+					*dst = pcolor;
+				}
+				dst += _out.pitch;
+				mask += _numStrips;
+				y++;
+			}
+		} else {
+			dst += n * _out.pitch;
+			mask += n * _numStrips;
+			y += n;
+		}
+
+		if (!height) {
+			if (!--v1.skip_width)
+				return;
+			height = _height;
+			y = v1.y;
+
+			if (_scaleX == 255 || v1.scaletable[_scaleIndexX] < _scaleX) {
+				v1.x += v1.scaleXstep;
+				if (v1.x < 0 || v1.x >= _out.w)
+					return;
+				maskbit = revBitMask(v1.x & 7);
+				v1.destptr += v1.scaleXstep;
+			}
+			_scaleIndexX += v1.scaleXstep;
+			dst = v1.destptr;
+			mask = v1.mask_ptr + v1.x / 8;
+			columnVisible = (v1.x >= 0 && v1.x < _out.w);
+		}
+	} while (1);
+}
+
 void ClassicCostumeRenderer::proc3_ami(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/debug-channels.h"
 #include "common/file.h"
 #include "common/str.h"
@@ -37,6 +38,8 @@
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -71,6 +74,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("actors",    WRAP_METHOD(ScummDebugger, Cmd_PrintActor));
 	registerCmd("box",       WRAP_METHOD(ScummDebugger, Cmd_PrintBox));
 	registerCmd("matrix",    WRAP_METHOD(ScummDebugger, Cmd_PrintBoxMatrix));
+	registerCmd("boxbench",  WRAP_METHOD(ScummDebugger, Cmd_BoxBenchmark));
 	registerCmd("camera",    WRAP_METHOD(ScummDebugger, Cmd_Camera));
 	registerCmd("room",      WRAP_METHOD(ScummDebugger, Cmd_Room));
 	registerCmd("objects",   WRAP_METHOD(ScummDebugger, Cmd_PrintObjects));
@@ -79,6 +83,9 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	registerCmd("resources", WRAP_METHOD(ScummDebugger, Cmd_PrintResources));
+	registerCmd("stripcache", WRAP_METHOD(ScummDebugger, Cmd_StripCache));
+	registerCmd("profile",   WRAP_METHOD(ScummDebugger, Cmd_Profile));
 
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -322,6 +329,135 @@ bool ScummDebugger::Cmd_ImportRes(int argc, const char** argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_PrintResources(int argc, const char **argv) {
+	uint32 numLoaded = 0;
+
+	debugPrintf("+------------+------+--------+-------+--------+\n");
+	debugPrintf("|type        |loaded|   bytes|expired|reloaded|\n");
+	debugPrintf("+------------+------+--------+-------+--------+\n");
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		const ResourceManager::ResTypeData &data = _vm->_res->_types[type];
+
+		uint32 loaded = 0;
+		for (ResId idx = 0; idx < data.size(); idx++) {
+			if (data[idx]._address)
+				loaded++;
+		}
+		numLoaded += loaded;
+
+		if (loaded || data._numExpired) {
+			debugPrintf("|%-12s|%6d|%8d|%7d|%8d|\n",
+					nameOfResType(type), loaded, data._allocatedSize,
+					data._numExpired, data._numReloaded);
+		}
+	}
+	debugPrintf("+------------+------+--------+-------+--------+\n");
+	debugPrintf("Total: %d resources, %d bytes\n", numLoaded, _vm->_res->getAllocatedSize());
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_StripCache(int argc, const char **argv) {
+	Gdi *gdi = _vm->_gdi;
+
+	if (argc > 1) {
+		if (!strcmp(argv[1], "on")) {
+			gdi->_stripCacheEnabled = true;
+		} else if (!strcmp(argv[1], "off")) {
+			gdi->_stripCacheEnabled = false;
+			gdi->invalidateStripCache();
+		} else if (!strcmp(argv[1], "flush")) {
+			gdi->invalidateStripCache();
+		} else {
+			debugPrintf("Syntax: stripcache [on|off|flush]\n");
+			return true;
+		}
+	}
+
+	debugPrintf("Strip cache is %s, holding %d bytes\n", gdi->_stripCacheEnabled ? "on" : "off", gdi->getStripCacheSize());
+	debugPrintf("Last background redraw: %d strips decoded, %d from cache\n", gdi->_stripsDecoded, gdi->_stripCacheHits);
+	return true;
+}
+
+struct ProfileEntry {
+	Common::String name;
+	uint32 count;
+	uint32 millis;
+};
+
+static bool profileEntryLess(const ProfileEntry &a, const ProfileEntry &b) {
+	if (a.millis != b.millis)
+		return a.millis > b.millis;
+	return a.count > b.count;
+}
+
+bool ScummDebugger::Cmd_Profile(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Syntax: profile on|off|reset|dump [count]|flame <filename>\n");
+		debugPrintf("Script profiling is %s\n", _vm->_scriptProfiling ? "on" : "off");
+		return true;
+	}
+
+	if (!strcmp(argv[1], "on")) {
+		if (!_vm->_scriptProfiling)
+			_vm->resetScriptProfile();
+		_vm->_scriptProfiling = true;
+		debugPrintf("Script profiling enabled\n");
+	} else if (!strcmp(argv[1], "off")) {
+		_vm->_scriptProfiling = false;
+		debugPrintf("Script profiling disabled\n");
+	} else if (!strcmp(argv[1], "reset")) {
+		_vm->resetScriptProfile();
+	} else if (!strcmp(argv[1], "dump")) {
+		uint limit = (argc > 2) ? atoi(argv[2]) : 20;
+		Common::Array<ProfileEntry> scripts, opcodes;
+
+		for (Common::HashMap<uint32, ScummEngine::ProfileCounter>::const_iterator it = _vm->_scriptProfile.begin(); it != _vm->_scriptProfile.end(); ++it) {
+			ProfileEntry e = { ScummEngine::getProfileScriptName(it->_key), it->_value.count, it->_value.millis };
+			scripts.push_back(e);
+		}
+		for (int i = 0; i < 256; i++) {
+			if (_vm->_opcodeProfile[i].count) {
+				ProfileEntry e = { _vm->getProfileOpcodeName(i), _vm->_opcodeProfile[i].count, _vm->_opcodeProfile[i].millis };
+				opcodes.push_back(e);
+			}
+		}
+		Common::sort(scripts.begin(), scripts.end(), profileEntryLess);
+		Common::sort(opcodes.begin(), opcodes.end(), profileEntryLess);
+
+		debugPrintf("+----------------------+----------+--------+\n");
+		debugPrintf("|script                |   opcodes|      ms|\n");
+		debugPrintf("+----------------------+----------+--------+\n");
+		for (uint i = 0; i < scripts.size() && i < limit; i++)
+			debugPrintf("|%-22s|%10d|%8d|\n", scripts[i].name.c_str(), scripts[i].count, scripts[i].millis);
+		debugPrintf("+----------------------+----------+--------+\n");
+		debugPrintf("|opcode                |     calls|      ms|\n");
+		debugPrintf("+----------------------+----------+--------+\n");
+		for (uint i = 0; i < opcodes.size() && i < limit; i++)
+			debugPrintf("|%-22s|%10d|%8d|\n", opcodes[i].name.c_str(), opcodes[i].count, opcodes[i].millis);
+		debugPrintf("+----------------------+----------+--------+\n");
+	} else if (!strcmp(argv[1], "flame") && argc > 2) {
+		Common::DumpFile out;
+		if (!out.open(argv[2])) {
+			debugPrintf("Could not open '%s' for writing\n", argv[2]);
+			return true;
+		}
+
+		// One "frame;frame;frame value" line per call stack, as expected
+		// by flamegraph.pl and compatible tools.
+		for (Common::HashMap<Common::String, uint32>::const_iterator it = _vm->_profileStacks.begin(); it != _vm->_profileStacks.end(); ++it)
+			out.writeString(Common::String::format("%s %d\n", it->_key.c_str(), it->_value));
+		out.finalize();
+		out.close();
+
+		debugPrintf("Wrote %d call stacks to '%s'\n", _vm->_profileStacks.size(), argv[2]);
+	} else {
+		debugPrintf("Syntax: profile on|off|reset|dump [count]|flame <filename>\n");
+	}
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	int i;
 	ScriptSlot *ss = _vm->vm.slot;
@@ -584,6 +720,75 @@ bool ScummDebugger::Cmd_PrintBoxMatrix(int argc, const char **argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_BoxBenchmark(int argc, const char **argv) {
+	const int num = _vm->getNumBoxes();
+	if (_vm->_game.version < 3 || !num) {
+		debugPrintf("No walkboxes to benchmark in this room\n");
+		return true;
+	}
+
+	const int iterations = (argc > 1) ? atoi(argv[1]) : 100;
+	if (iterations <= 0) {
+		debugPrintf("Syntax: boxbench [iterations]\n");
+		return true;
+	}
+
+	// The current box matrix may come straight from the game data files, so
+	// keep a copy to put back afterwards.
+	uint32 matrixSize = 0;
+	byte *savedMatrix = NULL;
+	if (_vm->_res->isResourceLoaded(rtMatrix, 1)) {
+		matrixSize = _vm->getResourceSize(rtMatrix, 1);
+		savedMatrix = (byte *)malloc(matrixSize);
+		memcpy(savedMatrix, _vm->getResourceAddress(rtMatrix, 1), matrixSize);
+	}
+	const Common::Array<bool> savedInvisible = _vm->_boxMatrixInvisible;
+
+	// Rebuild the box matrix from scratch, including the box geometry
+	uint32 start = g_system->getMillis();
+	for (int i = 0; i < iterations; i++) {
+		_vm->invalidateBoxCache();
+		_vm->createBoxMatrix();
+	}
+	const uint32 coldTime = g_system->getMillis() - start;
+
+	// Rebuild the box matrix with the box geometry already known
+	start = g_system->getMillis();
+	for (int i = 0; i < iterations; i++) {
+		_vm->_boxMatrixInvisible.clear();
+		_vm->createBoxMatrix();
+	}
+	const uint32 warmTime = g_system->getMillis() - start;
+
+	// Replay walk requests between every pair of boxes
+	uint32 steps = 0;
+	start = g_system->getMillis();
+	for (int i = 0; i < iterations; i++) {
+		for (int from = 0; from < num; from++) {
+			for (int to = 0; to < num; to++) {
+				int box = from;
+				for (int n = 0; box != to && box >= 0 && n < num; n++) {
+					box = _vm->getNextBox(box, to);
+					steps++;
+				}
+			}
+		}
+	}
+	const uint32 walkTime = g_system->getMillis() - start;
+
+	if (savedMatrix) {
+		memcpy(_vm->_res->createResource(rtMatrix, 1, matrixSize), savedMatrix, matrixSize);
+		free(savedMatrix);
+	}
+	_vm->_boxMatrixInvisible = savedInvisible;
+
+	debugPrintf("%d boxes, %d iterations\n", num, iterations);
+	debugPrintf("Box matrix, uncached geometry: %d ms\n", coldTime);
+	debugPrintf("Box matrix, cached geometry:   %d ms\n", warmTime);
+	debugPrintf("Walk requests: %d steps in %d ms\n", steps, walkTime);
+	return true;
+}
+
 void ScummDebugger::printBox(int box) {
 	if (box < 0 || box >= _vm->getNumBoxes()) {
 		debugPrintf("%d is not a valid box!\n", box);
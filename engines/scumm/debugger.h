@@ -49,6 +49,7 @@ private:
 	bool Cmd_PrintActor(int argc, const char **argv);
 	bool Cmd_PrintBox(int argc, const char **argv);
 	bool Cmd_PrintBoxMatrix(int argc, const char **argv);
+	bool Cmd_BoxBenchmark(int argc, const char **argv);
 	bool Cmd_PrintObjects(int argc, const char **argv);
 	bool Cmd_Actor(int argc, const char **argv);
 	bool Cmd_Camera(int argc, const char **argv);
@@ -56,6 +57,9 @@ private:
 	bool Cmd_Script(int argc, const char **argv);
 	bool Cmd_PrintScript(int argc, const char **argv);
 	bool Cmd_ImportRes(int argc, const char **argv);
+	bool Cmd_PrintResources(int argc, const char **argv);
+	bool Cmd_StripCache(int argc, const char **argv);
+	bool Cmd_Profile(int argc, const char **argv);
 
 	bool Cmd_PrintDraft(int argc, const char **argv);
 	bool Cmd_Passcode(int argc, const char **argv);
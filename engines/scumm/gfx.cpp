@@ -215,9 +215,18 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+
+	_stripCacheImage = 0;
+	_stripCacheHeight = 0;
+	_stripCacheNumZBuffer = 0;
+	_stripCacheSupported = true;
+	_stripCacheEnabled = true;
+	_stripsDecoded = 0;
+	_stripCacheHits = 0;
 }
 
 Gdi::~Gdi() {
+	invalidateStripCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(0) {
@@ -225,11 +234,13 @@ GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(0) {
 
 
 GdiNES::GdiNES(ScummEngine *vm) : Gdi(vm) {
+	_stripCacheSupported = false;
 	memset(&_NES, 0, sizeof(_NES));
 }
 
 #ifdef USE_RGB_COLOR
 GdiPCEngine::GdiPCEngine(ScummEngine *vm) : Gdi(vm) {
+	_stripCacheSupported = false;
 	memset(&_PCE, 0, sizeof(_PCE));
 }
 
@@ -241,10 +252,12 @@ GdiPCEngine::~GdiPCEngine() {
 #endif
 
 GdiV1::GdiV1(ScummEngine *vm) : Gdi(vm) {
+	_stripCacheSupported = false;
 	memset(&_V1, 0, sizeof(_V1));
 }
 
 GdiV2::GdiV2(ScummEngine *vm) : Gdi(vm) {
+	_stripCacheSupported = false;
 	_roomStrips = 0;
 }
 
@@ -254,6 +267,7 @@ GdiV2::~GdiV2() {
 
 #ifdef USE_RGB_COLOR
 GdiHE16bit::GdiHE16bit(ScummEngine *vm) : GdiHE(vm) {
+	_stripCacheSupported = false;
 }
 #endif
 
@@ -922,6 +936,9 @@ void ScummEngine::redrawBGAreas() {
 	int diff;
 	int val = 0;
 
+	_gdi->_stripsDecoded = 0;
+	_gdi->_stripCacheHits = 0;
+
 	if (_game.id != GID_PASS && _game.version >= 4 && _game.version <= 6) {
 		// Starting with V4 games (with the exception of the PASS demo), text
 		// is drawn over the game graphics (as  opposed to be drawn in a
@@ -1808,6 +1825,10 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		sx = 0;
 	}
 
+	const bool useStripCache = canUseStripCache(ptr, vs, y, height, numzbuf, flag);
+	if (useStripCache && (int)_stripCache.size() < stripnr + numstrip)
+		_stripCache.resize(stripnr + numstrip);
+
 	// Compute the number of strips we have to iterate over.
 	// TODO/FIXME: The computation of its initial value looks very fishy.
 	// It was added as a kind of hack to fix some corner cases, but it compares
@@ -1832,7 +1853,20 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->getBasePtr(x * 8, y);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		byte *cachedStrip = useStripCache ? _stripCache[stripnr] : 0;
+		if (cachedStrip) {
+			for (int h = 0; h < height; h++)
+				memcpy(dstPtr + h * vs->pitch, cachedStrip + h * 8, 8);
+			transpStrip = false;
+			_stripCacheHits++;
+		} else {
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+			_stripsDecoded++;
+		}
+
+		// Transparent strips leave whatever was below them untouched, so
+		// only opaque strips can be replayed from the cache.
+		const bool storeStrip = useStripCache && !cachedStrip && !transpStrip;
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -1846,7 +1880,35 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
 		}
 
-		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		if (cachedStrip) {
+			const byte *src = cachedStrip + 8 * height;
+			for (int i = 1; i < numzbuf; i++, src += height) {
+				if (!zplane_list[i])
+					continue;
+				byte *mask_ptr = getMaskBuffer(x, y, i);
+				for (int h = 0; h < height; h++)
+					mask_ptr[h * _numStrips] = src[h];
+			}
+		} else {
+			decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		}
+
+		if (storeStrip) {
+			byte *entry = (byte *)malloc((8 + numzbuf - 1) * height);
+			if (entry) {
+				for (int h = 0; h < height; h++)
+					memcpy(entry + h * 8, dstPtr + h * vs->pitch, 8);
+				byte *dst = entry + 8 * height;
+				for (int i = 1; i < numzbuf; i++, dst += height) {
+					if (!zplane_list[i])
+						continue;
+					const byte *mask_ptr = getMaskBuffer(x, y, i);
+					for (int h = 0; h < height; h++)
+						dst[h] = mask_ptr[h * _numStrips];
+				}
+				_stripCache[stripnr] = entry;
+			}
+		}
 
 #if 0
 		// HACK: blit mask(s) onto normal screen. Useful to debug masking
@@ -1874,6 +1936,51 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	}
 }
 
+void Gdi::invalidateStripCache() {
+	for (uint i = 0; i < _stripCache.size(); i++)
+		free(_stripCache[i]);
+	_stripCache.clear();
+	_stripCacheImage = 0;
+}
+
+uint32 Gdi::getStripCacheSize() const {
+	uint32 size = 0;
+	for (uint i = 0; i < _stripCache.size(); i++) {
+		if (_stripCache[i])
+			size += (8 + _stripCacheNumZBuffer - 1) * _stripCacheHeight;
+	}
+	return size;
+}
+
+/**
+ * Check whether the strips about to be drawn by drawBitmap() can be served
+ * from (and stored in) the strip cache. Only full height room backgrounds
+ * drawn to the main virtual screen qualify; objects and anything drawn with
+ * special flags are always decoded. If the room image differs from the one
+ * the cache was filled for, the cache is flushed. Since some decoders map
+ * pixels through _roomPalette, anything changing it must flush the cache too.
+ */
+bool Gdi::canUseStripCache(const byte *ptr, VirtScreen *vs, int y, int height, int numzbuf, byte flag) {
+	if (!_stripCacheSupported || !_stripCacheEnabled)
+		return false;
+	if (flag || _objectMode || _zbufferDisabled)
+		return false;
+	if (vs != &_vm->_virtscr[kMainVirtScreen] || vs->format.bytesPerPixel != 1 || y != 0 || height != vs->h)
+		return false;
+	// The Amiga versions remap colors through the current palette while
+	// decoding, so the decoded data is not stable across palette changes.
+	if (_vm->_game.platform == Common::kPlatformAmiga)
+		return false;
+
+	if (ptr != _stripCacheImage || height != _stripCacheHeight || numzbuf != _stripCacheNumZBuffer) {
+		invalidateStripCache();
+		_stripCacheImage = ptr;
+		_stripCacheHeight = height;
+		_stripCacheNumZBuffer = numzbuf;
+	}
+	return true;
+}
+
 bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr) {
 	// Do some input verification and make sure the strip/strip offset
@@ -24,6 +24,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/array.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -197,6 +198,20 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * Decoded room background strips, indexed by strip number. Each entry
+	 * holds the 8 pixel wide strip followed by its z-plane masks, so that
+	 * redrawing a strip (e.g. when scrolling) does not decompress it again.
+	 * Entries are only valid for the room image _stripCacheImage.
+	 */
+	Common::Array<byte *> _stripCache;
+	const byte *_stripCacheImage;
+	int _stripCacheHeight;
+	int _stripCacheNumZBuffer;
+
+	/** False for renderers which do not decode strips through decompressBitmap(). */
+	bool _stripCacheSupported;
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -205,6 +220,10 @@ public:
 	int _imgBufOffs[8];
 	int32 _numStrips;
 
+	bool _stripCacheEnabled;
+	/** Number of strips decoded / taken from the strip cache by the last background redraw. */
+	uint32 _stripsDecoded, _stripCacheHits;
+
 protected:
 	/* Bitmap decompressors */
 	bool decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess);
@@ -231,6 +250,7 @@ protected:
 
 	/* Misc */
 	int getZPlanes(const byte *smap_ptr, const byte *zplane_list[9], bool bmapImage) const;
+	bool canUseStripCache(const byte *ptr, VirtScreen *vs, int y, int height, int numzbuf, byte flag);
 
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
@@ -267,6 +287,9 @@ public:
 
 	void resetBackground(int top, int bottom, int strip);
 
+	void invalidateStripCache();
+	uint32 getStripCacheSize() const;
+
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
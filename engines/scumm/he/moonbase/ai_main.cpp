@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/memorypool.h"
+
 #include "scumm/he/intern_he.h"
 
 #include "scumm/he/moonbase/moonbase.h"
@@ -160,6 +162,14 @@ AI::AI(ScummEngine_v100he *vm) : _vm(vm) {
 
 	memset(_moveList, 0, sizeof(_moveList));
 	_mcpParams = 0;
+
+	_nodePool = new Common::MemoryPool(sizeof(Node));
+	Node::setPool(_nodePool);
+}
+
+AI::~AI() {
+	Node::setPool(NULL);
+	delete _nodePool;
 }
 
 void AI::resetAI() {
@@ -86,6 +86,7 @@ enum {
 class AI {
 public:
 	AI(ScummEngine_v100he *vm);
+	~AI();
 
 	void resetAI();
 	void cleanUpAI();
@@ -204,6 +205,10 @@ public:
 	patternList *_moveList[5];
 
 	const int32 *_mcpParams;
+
+private:
+	/** Backing storage for the search tree nodes, see Node::_pool */
+	Common::MemoryPool *_nodePool;
 };
 
 } // End of namespace Scumm
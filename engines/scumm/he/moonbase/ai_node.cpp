@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/memorypool.h"
+
 #include "scumm/he/moonbase/ai_node.h"
 
 namespace Scumm {
@@ -30,6 +32,21 @@ IContainedObject::IContainedObject(IContainedObject &sourceContainedObject) {
 }
 
 int Node::_nodeCount = 0;
+Common::MemoryPool *Node::_pool = NULL;
+
+void *Node::operator new(size_t size) {
+	assert(size == sizeof(Node));
+	assert(_pool);
+
+	return _pool->allocChunk();
+}
+
+void Node::operator delete(void *ptr) {
+	if (!ptr)
+		return;
+
+	_pool->freeChunk(ptr);
+}
 
 Node::Node() {
 	_parent = NULL;
@@ -43,6 +60,7 @@ Node::Node(Node *sourceNode) {
 	_children = sourceNode->getChildren();
 
 	_depth = sourceNode->getDepth();
+	_nodeCount++;
 
 	_contents = sourceNode->getContainedObject()->duplicate();
 }
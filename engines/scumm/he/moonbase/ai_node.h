@@ -25,6 +25,10 @@
 
 #include "common/array.h"
 
+namespace Common {
+class MemoryPool;
+}
+
 namespace Scumm {
 
 const float SUCCESS = -1;
@@ -70,13 +74,28 @@ private:
 	int _depth;
 	static int _nodeCount;
 
+	/**
+	 * Storage for all live nodes. Search trees allocate and free nodes by the
+	 * thousand, so they are carved out of fixed-size chunks instead of being
+	 * allocated individually. The pool is owned by the AI and outlives every
+	 * search.
+	 */
+	static Common::MemoryPool *_pool;
+
 	IContainedObject *_contents;
 
+	// Nodes are only duplicated through Node(Node *), which keeps the node count
+	Node(const Node &);
+	Node &operator=(const Node &);
+
 public:
 	Node();
 	Node(Node *sourceNode);
 	~Node();
 
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr);
+
 	void setParent(Node *parentPtr) { _parent = parentPtr; }
 	Node *getParent() const { return _parent; }
 
@@ -84,6 +103,7 @@ public:
 	int getDepth() const { return _depth; }
 
 	static int getNodeCount() { return _nodeCount; }
+	static void setPool(Common::MemoryPool *pool) { _pool = pool; }
 
 	void setContainedObject(IContainedObject *value) { _contents = value; }
 	IContainedObject *getContainedObject() { return _contents; }
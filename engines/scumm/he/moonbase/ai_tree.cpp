@@ -28,13 +28,46 @@
 
 namespace Scumm {
 
-static int compareTreeNodes(const void *a, const void *b) {
-	if (((const TreeNode *)a)->value < ((const TreeNode *)b)->value)
-		return -1;
-	else if (((const TreeNode *)a)->value > ((const TreeNode *)b)->value)
-		return 1;
-	else
-		return 0;
+void OpenSet::push(float value, Node *node) {
+	uint pos = _heap.size();
+	_heap.push_back(TreeNode(value, node, _nextOrder++));
+
+	// Sift the new entry up
+	while (pos > 0) {
+		uint parent = (pos - 1) / 2;
+		if (!isBefore(_heap[pos], _heap[parent]))
+			break;
+
+		SWAP(_heap[pos], _heap[parent]);
+		pos = parent;
+	}
+}
+
+Node *OpenSet::pop() {
+	Node *node = _heap[0].node;
+
+	_heap[0] = _heap.back();
+	_heap.pop_back();
+
+	// Sift the moved entry down
+	uint pos = 0;
+	const uint size = _heap.size();
+	for (;;) {
+		uint child = pos * 2 + 1;
+		if (child >= size)
+			break;
+
+		if (child + 1 < size && isBefore(_heap[child + 1], _heap[child]))
+			child++;
+
+		if (!isBefore(_heap[child], _heap[pos]))
+			break;
+
+		SWAP(_heap[pos], _heap[child]);
+		pos = child;
+	}
+
+	return node;
 }
 
 Tree::Tree(AI *ai) : _ai(ai) {
@@ -43,8 +76,6 @@ Tree::Tree(AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
@@ -54,8 +85,6 @@ Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
@@ -65,8 +94,6 @@ Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai(ai) {
@@ -76,8 +103,6 @@ Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai
 	_maxNodes = maxNodes;
 	_currentNode = 0;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 void Tree::duplicateTree(Node *sourceNode, Node *destNode) {
@@ -96,7 +121,6 @@ Tree::Tree(const Tree *sourceTree, AI *ai) : _ai(ai) {
 	pBaseNode = new Node(sourceTree->getBaseNode());
 	_maxDepth = sourceTree->getMaxDepth();
 	_maxNodes = sourceTree->getMaxNodes();
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 	_currentNode = 0;
 	_currentChildIndex = 0;
 
@@ -120,12 +144,10 @@ Tree::~Tree() {
 			pTemp = NULL;
 		}
 	}
-
-	delete _currentMap;
 }
 
 Node *Tree::aStarSearch() {
-	Common::SortedArray<TreeNode *> mmfpOpen(compareTreeNodes);
+	OpenSet mmfpOpen;
 
 	Node *currentNode = NULL;
 	float currentT;
@@ -135,11 +157,10 @@ Node *Tree::aStarSearch() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		mmfpOpen.insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		mmfpOpen.push(pBaseNode->getObjectT(), pBaseNode);
 
-		while (mmfpOpen.size() && (retNode == NULL)) {
-			currentNode = mmfpOpen.front()->node;
-			mmfpOpen.erase(mmfpOpen.begin());
+		while (!mmfpOpen.empty() && (retNode == NULL)) {
+			currentNode = mmfpOpen.pop();
 
 			if ((currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes)) {
 				// Generate nodes
@@ -152,7 +173,7 @@ Node *Tree::aStarSearch() {
 					if (currentT == SUCCESS)
 						retNode = *i;
 					else
-						mmfpOpen.insert(new TreeNode(currentT, (*i)));
+						mmfpOpen.push(currentT, *i);
 				}
 			} else {
 				retNode = currentNode;
@@ -174,7 +195,7 @@ Node *Tree::aStarSearch_singlePassInit() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		_currentMap->insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		_openSet.push(pBaseNode->getObjectT(), pBaseNode);
 	} else {
 		retNode = pBaseNode;
 	}
@@ -193,13 +214,12 @@ Node *Tree::aStarSearch_singlePass() {
 	}
 
 	if (_currentChildIndex) {
-		if (!(_currentMap->size())) {
+		if (_openSet.empty()) {
 			retNode = _currentNode;
 			return retNode;
 		}
 
-		_currentNode = _currentMap->front()->node;
-		_currentMap->erase(_currentMap->begin());
+		_currentNode = _openSet.pop();
 	}
 
 	if ((_currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes) && ((!maxTime) || (_ai->getTimerValue(3) < maxTime))) {
@@ -209,7 +229,7 @@ Node *Tree::aStarSearch_singlePass() {
 		if (_currentChildIndex) {
 			Common::Array<Node *> vChildren = _currentNode->getChildren();
 
-			if (!vChildren.size() && !_currentMap->size()) {
+			if (!vChildren.size() && _openSet.empty()) {
 				_currentChildIndex = 0;
 				retNode = _currentNode;
 			}
@@ -222,11 +242,11 @@ Node *Tree::aStarSearch_singlePass() {
 					retNode = *i;
 					i = vChildren.end() - 1;
 				} else {
-					_currentMap->insert(new TreeNode(currentT, (*i)));
+					_openSet.push(currentT, *i);
 				}
 			}
 
-			if (!(_currentMap->size()) && (currentT != SUCCESS)) {
+			if (_openSet.empty() && (currentT != SUCCESS)) {
 				assert(_currentNode != NULL);
 				retNode = _currentNode;
 			}
@@ -235,6 +255,9 @@ Node *Tree::aStarSearch_singlePass() {
 		retNode = _currentNode;
 	}
 
+	if (retNode)
+		debugC(DEBUG_MOONBASE_AI, "A* search done: %d nodes allocated, %d left open", Node::getNodeCount(), _openSet.size());
+
 	return retNode;
 }
 
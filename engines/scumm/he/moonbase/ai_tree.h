@@ -36,8 +36,38 @@ class AI;
 struct TreeNode {
 	float value;
 	Node *node;
+	uint32 order;
 
-	TreeNode(float v, Node *n) { value = v; node = n; }
+	TreeNode() : value(0), node(NULL), order(0) {}
+	TreeNode(float v, Node *n, uint32 o) : value(v), node(n), order(o) {}
+};
+
+/**
+ * Open set of the A* search, kept as a binary min-heap on the node value.
+ * Nodes of equal value are returned in insertion order. This differs from
+ * the SortedArray used before, which placed ties wherever its binary search
+ * happened to land, so the AI may now expand equally rated nodes in a
+ * different (but still deterministic) order.
+ */
+class OpenSet {
+private:
+	Common::Array<TreeNode> _heap;
+	uint32 _nextOrder;
+
+	static bool isBefore(const TreeNode &a, const TreeNode &b) {
+		if (a.value != b.value)
+			return a.value < b.value;
+		return a.order < b.order;
+	}
+
+public:
+	OpenSet() : _nextOrder(0) {}
+
+	bool empty() const { return _heap.empty(); }
+	uint size() const { return _heap.size(); }
+
+	void push(float value, Node *node);
+	Node *pop();
 };
 
 class Tree {
@@ -49,7 +79,7 @@ private:
 
 	int _currentChildIndex;
 
-	Common::SortedArray<TreeNode *> *_currentMap;
+	OpenSet _openSet;
 	Node *_currentNode;
 
 	AI *_ai;
@@ -25,6 +25,7 @@
 
 #ifdef ENABLE_HE
 
+#include "common/array.h"
 #include "common/winexe_pe.h"
 
 namespace Scumm {
@@ -106,6 +107,16 @@ private:
 
 	int32 _fowRenderTable[32768];
 
+	// Hotspots of the FOW image states, looked up once in setFOWImage()
+	Common::Array<int32> _fowStateSpotX;
+	Common::Array<int32> _fowStateSpotY;
+
+	// Visibility of the FOW info array cells, filled on demand while
+	// setFOWInfo() builds the render table; 0xFF marks unread cells.
+	Common::Array<byte> _fowVisibility;
+	int _fowVisibilityW;
+	int _fowVisibilityH;
+
 	Common::PEResources _exe;
 	Common::String _fileName;
 };
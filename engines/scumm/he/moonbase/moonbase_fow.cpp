@@ -60,6 +60,9 @@ void Moonbase::initFOW() {
 	_fowBlackMode = true;
 
 	memset(_fowRenderTable, 0, sizeof(_fowRenderTable));
+
+	_fowVisibilityW = 0;
+	_fowVisibilityH = 0;
 }
 
 void Moonbase::releaseFOWResources() {
@@ -67,6 +70,9 @@ void Moonbase::releaseFOWResources() {
 		free(_fowImage);
 		_fowImage = 0;
 	}
+
+	_fowStateSpotX.clear();
+	_fowStateSpotY.clear();
 }
 
 bool Moonbase::setFOWImage(int image) {
@@ -136,6 +142,11 @@ bool Moonbase::setFOWImage(int image) {
 
 	_fowAnimationFrames = (nStates + FOW_ANIM_FRAME_COUNT - 1) / FOW_ANIM_FRAME_COUNT;
 
+	_fowStateSpotX.resize(nStates);
+	_fowStateSpotY.resize(nStates);
+	for (int state = 0; state < nStates; state++)
+		_vm->_wiz->getWizImageSpot(_fowImage, state, _fowStateSpotX[state], _fowStateSpotY[state]);
+
 	_vm->_wiz->getWizImageDim(_fowImage, (nStates - 1), _fowTileW, _fowTileH);
 	_fowBlackMode = !_vm->_wiz->isWizPixelNonTransparent(_fowImage, nStates - 1, 0, 0, 0);
 
@@ -164,10 +175,22 @@ enum FOWElement {
 };
 
 int Moonbase::readFOWVisibilityArray(int array, int y, int x) {
-	if (readFromArray(array, x, y) > 0)
-		return FOW_EMPTY;
+	// setFOWInfo() looks at every cell up to nine times (once for itself
+	// and once for each of its neighbours), and going through the script
+	// array is not cheap, so remember what each cell said.
+	byte *cached = nullptr;
+	if (y >= 0 && y < _fowVisibilityH && x >= 0 && x < _fowVisibilityW) {
+		cached = &_fowVisibility[y * _fowVisibilityW + x];
+		if (*cached != 0xFF)
+			return *cached;
+	}
+
+	int visibility = (readFromArray(array, x, y) > 0) ? FOW_EMPTY : FOW_SOLID;
 
-	return FOW_SOLID;
+	if (cached)
+		*cached = visibility;
+
+	return visibility;
 }
 
 void Moonbase::setFOWInfo(int fowInfoArray, int downDim, int acrossDim, int viewX, int viewY, int clipX1,
@@ -198,6 +221,16 @@ void Moonbase::setFOWInfo(int fowInfoArray, int downDim, int acrossDim, int view
 	int dlw = dw * tw;
 	int dlh = dh * th;
 
+	if (dw > 0 && dh > 0) {
+		_fowVisibilityW = dw;
+		_fowVisibilityH = dh;
+		_fowVisibility.resize(dw * dh);
+		memset(_fowVisibility.begin(), 0xFF, dw * dh);
+	} else {
+		_fowVisibilityW = 0;
+		_fowVisibilityH = 0;
+	}
+
 	_fowMvx = (0 <= viewX) ? (viewX % dlw) : (dlw - (-viewX % dlw));
 	_fowMvy = (0 <= viewY) ? (viewY % dlh) : (dlh - (-viewY % dlh));
 
@@ -330,7 +363,13 @@ void Moonbase::setFOWInfo(int fowInfoArray, int downDim, int acrossDim, int view
 void Moonbase::renderFOWState(uint8 *destSurface, int dstPitch, int dstType, int dstw, int dsth, int x, int y, int srcw, int srch, int state, int flags) {
 	int32 spotx, spoty;
 
-	_vm->_wiz->getWizImageSpot(_fowImage, state, spotx, spoty);
+	if (state >= 0 && state < (int)_fowStateSpotX.size()) {
+		spotx = _fowStateSpotX[state];
+		spoty = _fowStateSpotY[state];
+	} else {
+		_vm->_wiz->getWizImageSpot(_fowImage, state, spotx, spoty);
+	}
+
 	Common::Rect r(_fowClipX1, _fowClipY1, _fowClipX2, _fowClipY2);
 
 	_vm->_wiz->drawWizImageEx(destSurface, _fowImage, 0, dstPitch, dstType, dstw, dsth, x - spotx, y - spoty, srcw, srch, state, &r, flags, 0, 0, 16, 0, 0);
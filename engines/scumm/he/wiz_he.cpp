@@ -370,7 +370,34 @@ void Wiz::writeColor(uint8 *dstPtr, int dstType, uint16 color) {
 	}
 }
 
+/**
+ * Fill a run of 'count' pixels with the same 16 bit color. The color is
+ * converted to the byte order of the destination only once.
+ */
+static void fill16BitColorRun(uint8 *&dstPtr, int dstInc, int dstType, uint16 color, int count) {
+	uint8 pixel[2];
+	Wiz::writeColor(pixel, dstType, color);
+	while (count--) {
+		dstPtr[0] = pixel[0];
+		dstPtr[1] = pixel[1];
+		dstPtr += dstInc;
+	}
+}
+
 #ifdef USE_RGB_COLOR
+/**
+ * Returns whether 16 bit pixels are stored in little endian byte order in
+ * the given type of destination, i.e. whether image data can be copied there
+ * unchanged.
+ */
+static bool isLittleEndianDstType(int dstType) {
+#ifdef SCUMM_LITTLE_ENDIAN
+	return true;
+#else
+	return dstType == kDstMemory || dstType == kDstResource;
+#endif
+}
+
 void Wiz::copy16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int dstType, int dstw, int dsth, int srcx, int srcy, int srcw, int srch, const Common::Rect *rect, int flags, const uint8 *xmapPtr) {
 	Common::Rect r1, r2;
 	if (calcClipRects(dstw, dsth, srcx, srcy, srcw, srch, rect, r1, r2)) {
@@ -771,9 +798,13 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
+					if (type == kWizCopy) {
+						fill16BitColorRun(dstPtr, dstInc, dstType, READ_LE_UINT16(dataPtr), code);
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr += 2;
 				} else {
@@ -791,10 +822,16 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dataPtr += 2;
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc == 2 && isLittleEndianDstType(dstType)) {
+						memcpy(dstPtr, dataPtr, code * 2);
+						dataPtr += code * 2;
+						dstPtr += code * 2;
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dataPtr += 2;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -905,9 +942,23 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (type == kWizXMap) {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
+					} else if (bitDepth == 2) {
+						const uint16 color = (type == kWizRMap) ? READ_LE_UINT16(palPtr + *dataPtr * 2) : *dataPtr;
+						fill16BitColorRun(dstPtr, dstInc, dstType, color, code);
+					} else {
+						const uint8 color = (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr;
+						if (dstInc > 0) {
+							memset(dstPtr, color, code);
+							dstPtr += code;
+						} else {
+							memset(dstPtr - code + 1, color, code);
+							dstPtr -= code;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -925,10 +976,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (type == kWizCopy && dstInc == 1) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -38,6 +38,16 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].isCompressed = false;
 		_budleDirCache[fileId].indexTable = NULL;
 	}
+
+	for (int i = 0; i < kBlockCacheSize; i++) {
+		_blockCache[i].slot = -1;
+		_blockCache[i].sampleIndex = -1;
+		_blockCache[i].block = -1;
+		_blockCache[i].outputSize = 0;
+		_blockCache[i].lastUsed = 0;
+		_blockCache[i].data = NULL;
+	}
+	_blockCacheCounter = 0;
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -45,6 +55,48 @@ BundleDirCache::~BundleDirCache() {
 		free(_budleDirCache[fileId].bundleTable);
 		free(_budleDirCache[fileId].indexTable);
 	}
+
+	for (int i = 0; i < kBlockCacheSize; i++)
+		free(_blockCache[i].data);
+}
+
+bool BundleDirCache::getCachedBlock(int slot, int32 sampleIndex, int32 block, byte *output, int32 &outputSize) {
+	Common::StackLock lock(_blockCacheMutex, "BundleDirCache::getCachedBlock()");
+
+	for (int i = 0; i < kBlockCacheSize; i++) {
+		BlockCacheEntry &entry = _blockCache[i];
+		if (entry.data && entry.slot == slot && entry.sampleIndex == sampleIndex && entry.block == block) {
+			memcpy(output, entry.data, entry.outputSize);
+			outputSize = entry.outputSize;
+			entry.lastUsed = ++_blockCacheCounter;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void BundleDirCache::cacheBlock(int slot, int32 sampleIndex, int32 block, const byte *output, int32 outputSize) {
+	Common::StackLock lock(_blockCacheMutex, "BundleDirCache::cacheBlock()");
+
+	// Replace the least recently used entry
+	BlockCacheEntry *victim = &_blockCache[0];
+	for (int i = 1; i < kBlockCacheSize; i++) {
+		if (_blockCache[i].lastUsed < victim->lastUsed)
+			victim = &_blockCache[i];
+	}
+
+	if (!victim->data) {
+		victim->data = (byte *)malloc(0x2000);
+		assert(victim->data);
+	}
+
+	memcpy(victim->data, output, outputSize);
+	victim->slot = slot;
+	victim->sampleIndex = sampleIndex;
+	victim->block = block;
+	victim->outputSize = outputSize;
+	victim->lastUsed = ++_blockCacheCounter;
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -145,6 +197,7 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_compTable = NULL;
 	_numFiles = 0;
 	_numCompItems = 0;
+	_cacheSlot = -1;
 	_curSampleId = -1;
 	_fileBundleId = -1;
 	_file = new ScummFile();
@@ -186,6 +239,7 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_cacheSlot = slot;
 	compressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -288,13 +342,17 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	for (i = firstBlock; i <= lastBlock; i++) {
 		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
+			if (!_cache->getCachedBlock(_cacheSlot, index, i, _compOutputBuff, _outputSize)) {
+				// CMI hack: one more zero byte at the end of input buffer
+				_compInputBuff[_compTable[i].size] = 0;
+				_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
+				_file->read(_compInputBuff, _compTable[i].size);
+				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+				if (_outputSize > 0x2000) {
+					error("_outputSize: %d", _outputSize);
+				}
+				if (_outputSize > 0)
+					_cache->cacheBlock(_cacheSlot, index, i, _compOutputBuff, _outputSize);
 			}
 			_lastBlock = i;
 		}
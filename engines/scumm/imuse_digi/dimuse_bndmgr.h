@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/mutex.h"
 
 namespace Scumm {
 
@@ -53,6 +54,27 @@ private:
 		IndexNode *indexTable;
 	} _budleDirCache[4];
 
+	/**
+	 * Recently decompressed bundle blocks, shared by all BundleMgr instances
+	 * so that tracks playing the same sound (e.g. during a crossfade) or
+	 * looping over the same region do not decompress its blocks again.
+	 */
+	enum {
+		kBlockCacheSize = 32
+	};
+
+	struct BlockCacheEntry {
+		int slot;
+		int32 sampleIndex;
+		int32 block;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte *data;
+	} _blockCache[kBlockCacheSize];
+
+	uint32 _blockCacheCounter;
+	Common::Mutex _blockCacheMutex;
+
 public:
 	BundleDirCache();
 	~BundleDirCache();
@@ -62,6 +84,9 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	bool getCachedBlock(int slot, int32 sampleIndex, int32 block, byte *output, int32 &outputSize);
+	void cacheBlock(int slot, int32 sampleIndex, int32 block, const byte *output, int32 outputSize);
 };
 
 class BundleMgr {
@@ -81,13 +106,14 @@ private:
 
 	int _numFiles;
 	int _numCompItems;
+	int _cacheSlot;
 	int _curSampleId;
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
 	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
+	int32 _outputSize;
 	int _lastBlock;
 
 	bool loadCompTable(int32 index);
@@ -413,6 +413,7 @@ void ScummEngine::setAmigaPaletteFromPtr(const byte *ptr) {
 		}
 	}
 
+	_gdi->invalidateStripCache();
 	setDirtyColors(0, 255);
 }
 
@@ -437,6 +438,7 @@ void ScummEngine::mapRoomPalette(int idx) {
 		_roomPalette[idx] = remapRoomPaletteColor(_currentPalette[idx * 3 + 0] >> 4,
 		                                          _currentPalette[idx * 3 + 1] >> 4,
 		                                          _currentPalette[idx * 3 + 2] >> 4);
+	_gdi->invalidateStripCache();
 }
 
 static const uint8 amigaWeightTable[16] = {
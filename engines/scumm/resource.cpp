@@ -48,6 +48,7 @@ enum {
 	RF_USAGE_MAX = RF_USAGE,
 
 	RS_MODIFIED = 0x10,
+	RS_EXPIRED = 0x20,
 	RF_OFFHEAP = 0x40
 };
 
@@ -540,9 +541,16 @@ void ResourceManager::allocResTypeData(ResType type, uint32 tag, int num, ResTyp
 
 	// If there was data in there, let's clear it out completely. This is important
 	// in case we are restarting the game.
+	for (ResId idx = 0; idx < _types[type].size(); idx++)
+		unlinkResource(&_types[type][idx]);
 	_types[type].clear();
 	_types[type].resize(num);
 
+	for (ResId idx = 0; idx < _types[type].size(); idx++) {
+		_types[type][idx]._type = type;
+		_types[type][idx]._idx = idx;
+	}
+
 /*
 	TODO: Use multiple Resource subclasses, one for each res mode; then,
 	given them serializability.
@@ -777,19 +785,51 @@ void ResourceManager::increaseExpireCounter() {
 }
 
 void ResourceManager::increaseResourceCounters() {
-	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-		ResId idx = _types[type].size();
-		while (idx-- > 0) {
-			byte counter = _types[type][idx].getResourceCounter();
-			if (counter && counter < RF_USAGE_MAX) {
-				setResourceCounter(type, idx, counter + 1);
-			}
+	// Only the counters of resources which can be expired are ever looked at,
+	// and those are exactly the ones in the counter lists. Move every list up
+	// by one, starting at the top so that no resource is incremented twice.
+	for (int counter = RF_USAGE_MAX - 1; counter > 0; counter--) {
+		Resource *res = _counterLists[counter];
+		while (res) {
+			Resource *next = res->_next;
+			setResourceCounter(res->_type, res->_idx, counter + 1);
+			res = next;
 		}
 	}
 }
 
 void ResourceManager::setResourceCounter(ResType type, ResId idx, byte counter) {
-	_types[type][idx].setResourceCounter(counter);
+	Resource *res = &_types[type][idx];
+	const bool linked = res->_prev || _counterLists[res->getResourceCounter()] == res;
+
+	if (linked)
+		unlinkResource(res);
+	res->setResourceCounter(counter);
+	if (linked)
+		linkResource(res);
+}
+
+void ResourceManager::linkResource(Resource *res) {
+	Resource *&head = _counterLists[res->getResourceCounter()];
+	res->_prev = NULL;
+	res->_next = head;
+	if (head)
+		head->_prev = res;
+	head = res;
+}
+
+void ResourceManager::unlinkResource(Resource *res) {
+	Resource *&head = _counterLists[res->getResourceCounter()];
+	if (res->_prev)
+		res->_prev->_next = res->_next;
+	else if (head == res)
+		head = res->_next;
+	else
+		return;	// Not linked
+
+	if (res->_next)
+		res->_next->_prev = res->_prev;
+	res->_prev = res->_next = NULL;
 }
 
 void ResourceManager::Resource::setResourceCounter(byte counter) {
@@ -830,10 +870,21 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 
 	memset(ptr, 0, size + SAFETY_AREA);
 	_allocatedSize += size;
+	_types[type]._allocatedSize += size;
+
+	Resource &res = _types[type][idx];
+	res._address = ptr;
+	res._size = size;
+	res.setResourceCounter(1);
+
+	if (_types[type]._mode != kDynamicResTypeMode) {
+		if (res._status & RS_EXPIRED) {
+			res._status &= ~RS_EXPIRED;
+			_types[type]._numReloaded++;
+		}
+		linkResource(&res);
+	}
 
-	_types[type][idx]._address = ptr;
-	_types[type][idx]._size = size;
-	setResourceCounter(type, idx, 1);
 	return ptr;
 }
 
@@ -844,6 +895,9 @@ ResourceManager::Resource::Resource() {
 	_status = 0;
 	_roomno = 0;
 	_roomoffs = 0;
+	_type = rtInvalid;
+	_idx = 0;
+	_prev = _next = 0;
 }
 
 ResourceManager::Resource::~Resource() {
@@ -862,6 +916,9 @@ void ResourceManager::Resource::nuke() {
 ResourceManager::ResTypeData::ResTypeData() {
 	_mode = kDynamicResTypeMode;
 	_tag = 0;
+	_allocatedSize = 0;
+	_numExpired = 0;
+	_numReloaded = 0;
 }
 
 ResourceManager::ResTypeData::~ResTypeData() {
@@ -872,6 +929,7 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	memset(_counterLists, 0, sizeof(_counterLists));
 }
 
 ResourceManager::~ResourceManager() {
@@ -898,6 +956,8 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 	if (ptr != NULL) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
+		_types[type]._allocatedSize -= _types[type][idx]._size;
+		unlinkResource(&_types[type][idx]);
 		_types[type][idx].nuke();
 	}
 }
@@ -1033,9 +1093,6 @@ void ResourceManager::Resource::setOnHeap() {
 }
 
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
-	ResType best_type;
-	int best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1048,30 +1105,29 @@ void ResourceManager::expireResources(uint32 size) {
 
 	oldAllocatedSize = _allocatedSize;
 
+	// Resources in the counter lists can be reloaded from the data files, so
+	// we can potentially unload them to free memory. Throw out the oldest ones
+	// first, skipping those which are locked or still in use. A resource that
+	// was skipped stays skipped, so each list is walked at most once.
+	int counter = RF_USAGE_MAX;
+	Resource *res = _counterLists[counter];
+
 	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
-				}
-			}
+		while (res && (res->isLocked() || res->isOffHeap() || _vm->isResourceInUse(res->_type, res->_idx)))
+			res = res->_next;
+
+		if (!res) {
+			if (--counter < 2)
+				break;
+			res = _counterLists[counter];
+			continue;
 		}
 
-		if (!best_type)
-			break;
-		nukeResource(best_type, best_res);
+		Resource *next = res->_next;
+		res->_status |= RS_EXPIRED;
+		_types[res->_type]._numExpired++;
+		nukeResource(res->_type, res->_idx);
+		res = next;
 	} while (size + _allocatedSize > _minHeapThreshold);
 
 	increaseResourceCounters();
@@ -81,6 +81,7 @@ protected:
 
 public:
 	class Resource {
+	friend class ResourceManager;
 	public:
 		/**
 		 * Pointer to the data contained in this resource
@@ -126,6 +127,20 @@ public:
 		 */
 		uint32 _roomoffs;
 
+	protected:
+		/**
+		 * Type and index of this resource, so that it can be expired when
+		 * reached through the counter lists below.
+		 */
+		ResType _type;
+		ResId _idx;
+
+		/**
+		 * Links in the list of loaded, expirable resources which share the
+		 * same counter value. See ResourceManager::_counterLists.
+		 */
+		Resource *_prev, *_next;
+
 	public:
 		Resource();
 		~Resource();
@@ -165,6 +180,18 @@ public:
 		 */
 		uint32 _tag;
 
+		/**
+		 * Number of bytes currently allocated for resources of this type.
+		 */
+		uint32 _allocatedSize;
+
+		/**
+		 * Number of resources of this type which were expired to free memory,
+		 * resp. which had to be loaded again after being expired.
+		 */
+		uint32 _numExpired;
+		uint32 _numReloaded;
+
 	public:
 		ResTypeData();
 		~ResTypeData();
@@ -176,6 +203,14 @@ protected:
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
 
+	/**
+	 * All loaded resources which may be expired (i.e. which can be reloaded
+	 * from the game data files) are kept in one doubly linked list per
+	 * resource counter value. This way expireResources can go straight to
+	 * the oldest resources instead of scanning every resource of every type.
+	 */
+	Resource *_counterLists[0x80];
+
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
@@ -224,11 +259,15 @@ public:
 	void increaseResourceCounters();
 
 	void resourceStats();
+	uint32 getAllocatedSize() const { return _allocatedSize; }
 
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+
+	void linkResource(Resource *res);
+	void unlinkResource(Resource *res);
 };
 
 } // End of namespace Scumm
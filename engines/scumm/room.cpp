@@ -481,6 +481,8 @@ void ScummEngine::resetRoomSubBlocks() {
 
 	_res->nukeResource(rtMatrix, 1);
 	_res->nukeResource(rtMatrix, 2);
+	invalidateBoxCache();
+	_gdi->invalidateStripCache();
 	if (_game.features & GF_SMALL_HEADER) {
 		ptr = findResourceData(MKTAG('B','O','X','D'), roomptr);
 		if (ptr) {
@@ -739,6 +741,8 @@ void ScummEngine_v3old::resetRoomSubBlocks() {
 	//
 	_res->nukeResource(rtMatrix, 1);
 	_res->nukeResource(rtMatrix, 2);
+	invalidateBoxCache();
+	_gdi->invalidateStripCache();
 
 	if (_game.version <= 2)
 		ptr = roomptr + *(roomptr + 0x15);
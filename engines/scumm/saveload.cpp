@@ -435,6 +435,8 @@ bool ScummEngine::loadState(int slot, bool compat, Common::String &filename) {
 			for (ResId idx = 0; idx < _res->_types[type].size(); idx++) {
 				_res->nukeResource(type, idx);
 			}
+	invalidateBoxCache();
+	_gdi->invalidateStripCache();
 
 	resetScummVars();
 
@@ -459,6 +459,11 @@ void ScummEngine::refreshScriptPointer() {
 /** Execute a script - Read opcode, and execute it from the table */
 void ScummEngine::executeScript() {
 	int c;
+
+	// Time spent outside of scripts (e.g. drawing) is not charged to them
+	if (_scriptProfiling)
+		_profileLastMillis = _system->getMillis(true);
+
 	while (_currentScript != 0xFF) {
 
 		if (_showStack == 1) {
@@ -483,7 +488,10 @@ void ScummEngine::executeScript() {
 			debugN("\n");
 		}
 
-		executeOpcode(_opcode);
+		if (_scriptProfiling)
+			executeOpcodeProfiled(_opcode);
+		else
+			executeOpcode(_opcode);
 
 	}
 }
@@ -496,6 +504,75 @@ void ScummEngine::executeOpcode(byte i) {
 	}
 }
 
+void ScummEngine::executeOpcodeProfiled(byte i) {
+	const ScriptSlot &ss = vm.slot[_currentScript];
+	const uint32 key = (ss.where << 16) | ss.number;
+
+	_opcodeProfile[i].count++;
+	_scriptProfile[key].count++;
+
+	executeOpcode(i);
+
+	const uint32 now = _system->getMillis(true);
+	const uint32 elapsed = now - _profileLastMillis;
+	if (!elapsed)
+		return;
+	_profileLastMillis = now;
+
+	// The opcode may have run nested scripts, which may have added to
+	// _scriptProfile, so look the entry up again.
+	_opcodeProfile[i].millis += elapsed;
+	_scriptProfile[key].millis += elapsed;
+
+	Common::String stack;
+	for (int n = 0; n < vm.numNestedScripts; n++) {
+		const NestedScript &nest = vm.nest[n];
+		if (nest.where == 0xFF)
+			continue;
+		stack += getProfileScriptName((nest.where << 16) | nest.number);
+		stack += ';';
+	}
+	stack += getProfileScriptName(key);
+	stack += ';';
+	stack += getProfileOpcodeName(i);
+	_profileStacks[stack] += elapsed;
+}
+
+void ScummEngine::resetScriptProfile() {
+	for (int i = 0; i < 256; i++)
+		_opcodeProfile[i] = ProfileCounter();
+	_scriptProfile.clear();
+	_profileStacks.clear();
+	_profileLastMillis = _system->getMillis(true);
+}
+
+Common::String ScummEngine::getProfileScriptName(uint32 key) {
+	const int where = key >> 16;
+	const int number = key & 0xFFFF;
+
+	switch (where) {
+	case WIO_INVENTORY:
+		return Common::String::format("inventory-%d", number);
+	case WIO_ROOM:
+		return Common::String::format("room-%d", number);
+	case WIO_GLOBAL:
+		return Common::String::format("global-%d", number);
+	case WIO_LOCAL:
+		return Common::String::format("local-%d", number);
+	case WIO_FLOBJECT:
+		return Common::String::format("flobject-%d", number);
+	default:
+		return Common::String::format("script-%d", number);
+	}
+}
+
+Common::String ScummEngine::getProfileOpcodeName(byte i) {
+	const char *desc = getOpcodeDesc(i);
+	if (desc && *desc)
+		return desc;
+	return Common::String::format("opcode-%02X", i);
+}
+
 const char *ScummEngine::getOpcodeDesc(byte i) {
 #ifndef REDUCE_MEMORY_USAGE
 	return _opcodes[i].desc;
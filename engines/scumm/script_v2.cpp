@@ -1540,6 +1540,7 @@ void ScummEngine_v2::o2_roomOps() {
 		} else {
 			_roomPalette[b] = a;
 		}
+		_gdi->invalidateStripCache();
 		_fullRedraw = true;
 		break;
 	}
@@ -3036,6 +3036,7 @@ void ScummEngine_v6::o6_setBoxSet() {
 
 	dboxSize = READ_BE_UINT32(boxd + 4) - 8;
 	byte *matrix = _res->createResource(rtMatrix, 2, dboxSize);
+	invalidateBoxCache();
 
 	assert(matrix);
 	memcpy(matrix, boxd + 8, dboxSize);
@@ -537,6 +537,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 
 	_hexdumpScripts = false;
 	_showStack = false;
+	_scriptProfiling = false;
+	_profileLastMillis = 0;
 
 	if (_game.platform == Common::kPlatformFMTowns && _game.version == 3) {	// FM-TOWNS V3 games use 320x240
 		_screenWidth = 320;
@@ -28,6 +28,7 @@
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/random.h"
@@ -39,6 +40,7 @@
 #include "graphics/surface.h"
 #include "graphics/sjis.h"
 
+#include "scumm/boxes.h"
 #include "scumm/gfx.h"
 #include "scumm/detection.h"
 #include "scumm/script.h"
@@ -92,7 +94,6 @@ class ScummDebugger;
 class Sound;
 
 struct Box;
-struct BoxCoords;
 struct FindObjectInRoom;
 
 // Use g_scumm from error() ONLY
@@ -658,6 +659,32 @@ protected:
 	void executeOpcode(byte i);
 	const char *getOpcodeDesc(byte i);
 
+	/**
+	 * Script profiler, controlled through the "profile" debugger command.
+	 * Opcodes are counted exactly; time is sampled, since getMillis() is
+	 * the only clock available: every millisecond that passes is charged
+	 * to the opcode (and script) which was running when it elapsed.
+	 */
+	struct ProfileCounter {
+		uint32 count;
+		uint32 millis;
+
+		ProfileCounter() : count(0), millis(0) {}
+	};
+
+	bool _scriptProfiling;
+	uint32 _profileLastMillis;
+	ProfileCounter _opcodeProfile[256];
+	/** Per script counters, keyed by (where << 16) | number. */
+	Common::HashMap<uint32, ProfileCounter> _scriptProfile;
+	/** Sampled milliseconds per call stack, in flame graph "folded" notation. */
+	Common::HashMap<Common::String, uint32> _profileStacks;
+
+	void executeOpcodeProfiled(byte i);
+	void resetScriptProfile();
+	static Common::String getProfileScriptName(uint32 key);
+	Common::String getProfileOpcodeName(byte i);
+
 	void initializeLocals(int slot, int *vars);
 	int	getScriptSlot();
 
@@ -1151,6 +1178,7 @@ public:
 	bool checkXYInBoxBounds(int box, int x, int y);
 
 	BoxCoords getBoxCoordinates(int boxnum);
+	void invalidateBoxCache();
 
 	byte getMaskFromBox(int box);
 	Box *getBoxBaseAddr(int box);
@@ -1176,6 +1204,22 @@ protected:
 	void createBoxMatrix();
 	virtual bool areBoxesNeighbors(int i, int j);
 
+	/**
+	 * Walkbox data derived from the current box set (V3+ only). Box
+	 * coordinates never change while a box set is loaded, so the coordinates
+	 * of all boxes and which of them touch each other (regardless of their
+	 * flags) are computed once. _boxMatrixInvisible records which boxes were
+	 * invisible when createBoxMatrix last computed the box matrix; if that
+	 * hasn't changed, the matrix doesn't need to be computed again.
+	 * All of this is reset by invalidateBoxCache whenever the box set changes.
+	 */
+	Common::Array<BoxCoords> _boxCoordsCache;
+	Common::Array<bool> _boxNeighborCache;
+	Common::Array<bool> _boxMatrixInvisible;
+
+	bool updateBoxCache();
+	BoxCoords readBoxCoordinates(int boxnum);
+
 	/* String class */
 public:
 	CharsetRenderer *_charset;
@@ -45,17 +45,6 @@ namespace Scumm {
 		(dst)[1] = (src)[1];	\
 	} while (0)
 
-
-#else /* SCUMM_NEED_ALIGNMENT */
-
-#define COPY_4X1_LINE(dst, src)			\
-	*(uint32 *)(dst) = *(const uint32 *)(src)
-
-#define COPY_2X1_LINE(dst, src)			\
-	*(uint16 *)(dst) = *(const uint16 *)(src)
-
-#endif
-
 #define FILL_4X1_LINE(dst, val)			\
 	do {					\
 		(dst)[0] = val;	\
@@ -70,6 +59,24 @@ namespace Scumm {
 		(dst)[1] = val;	\
 	} while (0)
 
+#else /* SCUMM_NEED_ALIGNMENT */
+
+#define COPY_4X1_LINE(dst, src)			\
+	*(uint32 *)(dst) = *(const uint32 *)(src)
+
+#define COPY_2X1_LINE(dst, src)			\
+	*(uint16 *)(dst) = *(const uint16 *)(src)
+
+// Fills replicate the pixel across a machine word, so that a 4x1 line is a
+// single store instead of four byte writes.
+#define FILL_4X1_LINE(dst, val)			\
+	*(uint32 *)(dst) = (byte)(val) * 0x01010101U
+
+#define FILL_2X1_LINE(dst, val)			\
+	*(uint16 *)(dst) = (uint16)((byte)(val) * 0x0101U)
+
+#endif
+
 static const  int8 codec47_table_small1[] = {
   0, 1, 2, 3, 3, 3, 3, 2, 1, 0, 0, 0, 1, 2, 2, 1,
 };
@@ -22,6 +22,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 
@@ -230,6 +231,8 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_base = NULL;
 	_frameBuffer = NULL;
 	_specialBuffer = NULL;
+	_chunkData = NULL;
+	_chunkDataSize = 0;
 
 	_seekPos = -1;
 
@@ -310,6 +313,10 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = NULL;
 
+	free(_chunkData);
+	_chunkData = NULL;
+	_chunkDataSize = 0;
+
 	_IACTstream = NULL;
 
 	_vm->_smushActive = false;
@@ -1044,9 +1051,26 @@ void SmushPlayer::parseNextFrame() {
 	case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
 		handleAnimHeader(subSize, *_base);
 		break;
-	case MKTAG('F','R','M','E'):
-		handleFrame(subSize, *_base);
+	case MKTAG('F','R','M','E'): {
+		// Pull the whole frame in with a single read, so that the
+		// sub-chunk handlers (FOBJ, IACT, PSAD, ...) parse from memory
+		// instead of issuing many small reads and seeks on the file.
+		// One spare byte is kept for the pad of an odd-sized last
+		// sub-chunk.
+		const uint32 neededSize = subSize + 1;
+		if (neededSize > _chunkDataSize) {
+			free(_chunkData);
+			_chunkData = (byte *)malloc(neededSize);
+			assert(_chunkData);
+			_chunkDataSize = neededSize;
+		}
+		const uint32 bytesRead = _base->read(_chunkData, subSize);
+		memset(_chunkData + bytesRead, 0, neededSize - bytesRead);
+
+		Common::MemoryReadStream frame(_chunkData, neededSize);
+		handleFrame(subSize, frame);
 		break;
+	}
 	default:
 		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
 	}
@@ -55,6 +55,8 @@ private:
 	uint32 _baseSize;
 	byte *_frameBuffer;
 	byte *_specialBuffer;
+	byte *_chunkData;
+	uint32 _chunkDataSize;
 
 	Common::String _seekFile;
 	uint32 _startFrame;
@@ -22,14 +22,50 @@
 
 #include "sword25/console.h"
 #include "sword25/sword25.h"
+#include "sword25/kernel/kernel.h"
+#include "sword25/gfx/graphicengine.h"
+#include "sword25/gfx/renderobjectmanager.h"
 
 namespace Sword25 {
 
 Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm) {
 	assert(_vm);
+
+	registerCmd("render_timing", WRAP_METHOD(Sword25Console, Cmd_RenderTiming));
 }
 
 Sword25Console::~Sword25Console() {
 }
 
+bool Sword25Console::Cmd_RenderTiming(int argc, const char **argv) {
+	GraphicEngine *gfx = Kernel::getInstance()->getGfx();
+	if (!gfx || !gfx->getRenderObjectManager()) {
+		debugPrintf("The graphics engine is not initialized\n");
+		return true;
+	}
+
+	RenderTiming &timing = gfx->getRenderObjectManager()->getTiming();
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		timing.reset();
+		debugPrintf("Render timing reset\n");
+		return true;
+	}
+
+	if (!timing.frames) {
+		debugPrintf("No frames rendered yet\n");
+		return true;
+	}
+
+	// Average milliseconds per frame for each phase of RenderObjectManager::render()
+	const float frames = timing.frames;
+	debugPrintf("Frames: %d\n", timing.frames);
+	debugPrintf("Update object state: %.2f ms\n", timing.updateMillis / frames);
+	debugPrintf("Build queue and update rects: %.2f ms\n", timing.queueMillis / frames);
+	debugPrintf("Draw render objects: %.2f ms\n", timing.drawMillis / frames);
+	debugPrintf("Copy to screen: %.2f ms\n", timing.copyMillis / frames);
+	debugPrintf("Update rects per frame: %.1f\n", timing.updateRects / frames);
+	debugPrintf("Use \"%s reset\" to start counting again\n", argv[0]);
+	return true;
+}
+
 } // End of namespace Sword25
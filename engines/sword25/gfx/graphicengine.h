@@ -235,6 +235,8 @@ public:
 	Common::SeekableReadStream *_thumbnail;
 	Common::SeekableReadStream *getThumbnail() { return _thumbnail; }
 
+	RenderObjectManager *getRenderObjectManager() { return _renderObjectManagerPtr.get(); }
+
 	// Access methods
 
 	/**
@@ -107,9 +107,8 @@ void MicroTileArray::updateBoundingBox(BoundingBox &boundingBox, byte x0, byte y
 	setBoundingBox(boundingBox, x0, y0, x1, y1);
 }
 
-RectangleList *MicroTileArray::getRectangles() {
-
-	RectangleList *rects = new RectangleList();
+void MicroTileArray::getRectangles(RectangleList &rects) {
+	rects.reset();
 
 	int x, y;
 	int x0, y0, x1, y1;
@@ -148,13 +147,11 @@ RectangleList *MicroTileArray::getRectangles() {
 
 			x1 = (x * TileSize) + TileX1(_tiles[i]);
 
-			rects->push_back(Common::Rect(x0, y0, x1 + 1, y1 + 1));
+			rects.push_back(Common::Rect(x0, y0, x1 + 1, y1 + 1));
 
 			++i;
 		}
 	}
-
-	return rects;
 }
 
 } // End of namespace Sword25
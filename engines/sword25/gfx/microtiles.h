@@ -24,7 +24,7 @@
 #define SWORD25_MICROTILES_H
 
 #include "common/scummsys.h"
-#include "common/list.h"
+#include "common/array.h"
 #include "common/util.h"
 #include "common/rect.h"
 
@@ -36,7 +36,15 @@ const BoundingBox FullBoundingBox  = 0x00001F1F;
 const BoundingBox EmptyBoundingBox = 0x00000000;
 const int TileSize = 32;
 
-class RectangleList : public Common::List<Common::Rect> {
+class RectangleList : public Common::Array<Common::Rect> {
+public:
+	/**
+	 * Empties the list, but keeps its storage for the next frame.
+	 */
+	void reset() {
+		// Rects need no destruction, so shrinking the size is enough
+		resize(0);
+	}
 };
 
 class MicroTileArray {
@@ -45,7 +53,7 @@ public:
 	~MicroTileArray();
 	void addRect(Common::Rect r);
 	void clear();
-	RectangleList *getRectangles();
+	void getRectangles(RectangleList &rects);
 protected:
 	BoundingBox *_tiles;
 	int16 _tilesW, _tilesH;
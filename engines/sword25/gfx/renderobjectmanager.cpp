@@ -46,16 +46,24 @@
 namespace Sword25 {
 
 void RenderObjectQueue::add(RenderObject *renderObject) {
+	_index[renderObject] = size();
 	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
 }
 
-bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) {
-	for (RenderObjectQueue::iterator it = begin(); it != end(); ++it)
-		if ((*it)._renderObject == renderObjectQueueItem._renderObject &&
-			(*it)._version == renderObjectQueueItem._version && 
-			(*it)._bbox == renderObjectQueueItem._bbox)
-			return true;
-	return false;
+bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) const {
+	IndexMap::const_iterator pos = _index.find(renderObjectQueueItem._renderObject);
+	if (pos == _index.end())
+		return false;
+
+	const RenderObjectQueueItem &item = (*this)[pos->_value];
+	return item._version == renderObjectQueueItem._version &&
+		item._bbox == renderObjectQueueItem._bbox;
+}
+
+void RenderObjectQueue::reset() {
+	// Queue items need no destruction, so shrinking the size is enough
+	resize(0);
+	_index.clear();
 }
 
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
@@ -88,6 +96,8 @@ void RenderObjectManager::startFrame() {
 }
 
 bool RenderObjectManager::render() {
+	uint32 startTime = g_system->getMillis();
+
 	// Den Objekt-Status des Wurzelobjektes aktualisieren. Dadurch werden rekursiv alle Baumelemente aktualisiert.
 	// Beim aktualisieren des Objekt-Status werden auch die Update-Rects gefunden, so dass feststeht, was neu gezeichnet
 	// werden muss.
@@ -96,9 +106,11 @@ bool RenderObjectManager::render() {
 
 	_frameStarted = false;
 
+	uint32 updateTime = g_system->getMillis();
+
 	// Die Render-Methode der Wurzel aufrufen. Dadurch wird das rekursive Rendern der Baumelemente angestoen.
 
-	_currQueue->clear();
+	_currQueue->reset();
 	_rootPtr->preRender(_currQueue);
 
 	_uta->clear();
@@ -115,30 +127,36 @@ bool RenderObjectManager::render() {
 			_uta->addRect((*it)._bbox);
 	}
 
-	RectangleList *updateRects = _uta->getRectangles();
-	Common::Array<int> updateRectsMinZ;
-
-	updateRectsMinZ.reserve(updateRects->size());
+	_uta->getRectangles(_updateRects);
+	_updateRectsMinZ.resize(0);
+	_updateRectsMinZ.reserve(_updateRects.size());
 
 	// Calculate the minimum drawing Z value of each update rectangle
 	// Solid bitmaps with a Z order less than the value calculated here would be overdrawn again and
 	// so don't need to be drawn in the first place which speeds things up a bit.
-	for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
+	for (RectangleList::iterator rectIt = _updateRects.begin(); rectIt != _updateRects.end(); ++rectIt) {
 		int minZ = 0;
-		for (RenderObjectQueue::iterator it = _currQueue->reverse_begin(); it != _currQueue->end(); --it) {
-			if ((*it)._renderObject->isVisible() && (*it)._renderObject->isSolid() &&
-				(*it)._renderObject->getBbox().contains(*rectIt)) {
-				minZ = (*it)._renderObject->getAbsoluteZ();
+		for (int i = (int)_currQueue->size() - 1; i >= 0; --i) {
+			RenderObject *renderObject = (*_currQueue)[i]._renderObject;
+			if (renderObject->isVisible() && renderObject->isSolid() &&
+				renderObject->getBbox().contains(*rectIt)) {
+				minZ = renderObject->getAbsoluteZ();
 				break;
 			}
 		}
-		updateRectsMinZ.push_back(minZ);
+		_updateRectsMinZ.push_back(minZ);
 	}
 
-	if (_rootPtr->render(updateRects, updateRectsMinZ)) {
+	uint32 queueTime = g_system->getMillis();
+	uint32 drawTime = queueTime;
+
+	// Nothing changed, so there is nothing to draw either
+	if (!_updateRects.empty() && _rootPtr->render(&_updateRects, _updateRectsMinZ)) {
+		drawTime = g_system->getMillis();
+
 		// Copy updated rectangles to the video screen
 		Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
-		for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
+		for (RectangleList::iterator rectIt = _updateRects.begin(); rectIt != _updateRects.end(); ++rectIt) {
 			const int x = (*rectIt).left;
 			const int y = (*rectIt).top;
 			const int width = (*rectIt).width();
@@ -147,7 +165,13 @@ bool RenderObjectManager::render() {
 		}
 	}
 
-	delete updateRects;
+	uint32 endTime = g_system->getMillis();
+	_timing.frames++;
+	_timing.updateMillis += updateTime - startTime;
+	_timing.queueMillis += queueTime - updateTime;
+	_timing.drawMillis += drawTime - queueTime;
+	_timing.copyMillis += endTime - drawTime;
+	_timing.updateRects += _updateRects.size();
 
 	SWAP(_currQueue, _prevQueue);
 
@@ -43,6 +43,9 @@
 #define SWORD25_RENDEROBJECTMANAGER_H
 
 #include "common/rect.h"
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/renderobjectptr.h"
 #include "sword25/kernel/persistable.h"
@@ -60,14 +63,43 @@ struct RenderObjectQueueItem {
 	RenderObject *_renderObject;
 	Common::Rect _bbox;
 	int _version;
+	RenderObjectQueueItem() : _renderObject(nullptr), _version(0) {}
 	RenderObjectQueueItem(RenderObject *renderObject, const Common::Rect &bbox, int version)
 		: _renderObject(renderObject), _bbox(bbox), _version(version) {}
 };
 
-class RenderObjectQueue : public Common::List<RenderObjectQueueItem> {
+class RenderObjectQueue : public Common::Array<RenderObjectQueueItem> {
 public:
 	void add(RenderObject *renderObject);
-	bool exists(const RenderObjectQueueItem &renderObjectQueueItem);
+	bool exists(const RenderObjectQueueItem &renderObjectQueueItem) const;
+	/**
+	 * Empties the queue, but keeps its storage for the next frame.
+	 */
+	void reset();
+
+private:
+	// Position of each render object in the queue, so that comparing
+	// two frames doesn't need to search the whole queue for every item
+	typedef Common::HashMap<RenderObject *, uint> IndexMap;
+	IndexMap _index;
+};
+
+/**
+ * Time spent in the phases of RenderObjectManager::render(), summed up
+ * over all frames since the last reset.
+ */
+struct RenderTiming {
+	uint32 frames;
+	uint32 updateMillis;
+	uint32 queueMillis;
+	uint32 drawMillis;
+	uint32 copyMillis;
+	uint32 updateRects;
+
+	RenderTiming() { reset(); }
+	void reset() {
+		frames = updateMillis = queueMillis = drawMillis = copyMillis = updateRects = 0;
+	}
 };
 
 /**
@@ -126,6 +158,10 @@ public:
 	virtual bool persist(OutputPersistenceBlock &writer);
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
+	RenderTiming &getTiming() {
+		return _timing;
+	}
+
 private:
 	bool _frameStarted;
 	typedef Common::Array<RenderObjectPtr<TimedRenderObject> > RenderObjectList;
@@ -133,6 +169,9 @@ private:
 
 	MicroTileArray *_uta;
 	RenderObjectQueue *_currQueue, *_prevQueue;
+	RectangleList _updateRects;
+	Common::Array<int> _updateRectsMinZ;
+	RenderTiming _timing;
 
 	// RenderObject-Tree Variablen
 	// ---------------------------
@@ -31,19 +31,22 @@
 
 #include "common/textconsole.h"
 
+#include "common/memstream.h"
+
 #include "sword25/kernel/inputpersistenceblock.h"
 
 namespace Sword25 {
 
 InputPersistenceBlock::InputPersistenceBlock(const void *data, uint dataLength, int version) :
-	_data(static_cast<const byte *>(data), dataLength),
+	_data(static_cast<const byte *>(data)),
+	_dataEnd(static_cast<const byte *>(data) + dataLength),
 	_errorState(NONE),
 	_version(version) {
-	_iter = _data.begin();
+	_iter = _data;
 }
 
 InputPersistenceBlock::~InputPersistenceBlock() {
-	if (_iter != _data.end())
+	if (_iter != _dataEnd)
 		warning("Persistence block was not read to the end.");
 }
 
@@ -118,8 +121,22 @@ void InputPersistenceBlock::readByteArray(Common::Array<byte> &value) {
 	}
 }
 
+Common::SeekableReadStream *InputPersistenceBlock::readByteStream() {
+	if (checkMarker(BLOCK_MARKER)) {
+		uint32 size;
+		read(size);
+
+		if (checkBlockSize(size)) {
+			Common::SeekableReadStream *stream = new Common::MemoryReadStream(_iter, size, DisposeAfterUse::NO);
+			_iter += size;
+			return stream;
+		}
+	}
+	return nullptr;
+}
+
 bool InputPersistenceBlock::checkBlockSize(int size) {
-	if (_data.end() - _iter >= size) {
+	if (_dataEnd - _iter >= size) {
 		return true;
 	} else {
 		_errorState = END_OF_DATA;
@@ -33,6 +33,7 @@
 #define SWORD25_INPUTPERSISTENCEBLOCK_H
 
 #include "common/array.h"
+#include "common/stream.h"
 #include "sword25/kernel/common.h"
 #include "sword25/kernel/persistenceblock.h"
 
@@ -46,6 +47,10 @@ public:
 		OUT_OF_SYNC
 	};
 
+	/**
+	 * @param data the persisted data. It is not copied, so it has to stay
+	 * valid for the lifetime of the block.
+	 */
 	InputPersistenceBlock(const void *data, uint dataLength, int version);
 	virtual ~InputPersistenceBlock();
 
@@ -56,6 +61,13 @@ public:
 	void read(bool &value);
 	void readString(Common::String &value);
 	void readByteArray(Common::Array<byte> &value);
+	/**
+	 * Reads a block without copying it.
+	 * @return a stream over the block content, or nullptr on error. The
+	 * stream reads from the data passed to the constructor, which must
+	 * outlive it. The caller has to delete the stream.
+	 */
+	Common::SeekableReadStream *readByteStream();
 
 	bool isGood() const {
 		return _errorState == NONE;
@@ -70,8 +82,9 @@ private:
 	bool checkMarker(byte marker);
 	bool checkBlockSize(int size);
 
-	Common::Array<byte> _data;
-	Common::Array<byte>::const_iterator _iter;
+	const byte *_data;
+	const byte *_dataEnd;
+	const byte *_iter;
 	ErrorState _errorState;
 
 	int _version;
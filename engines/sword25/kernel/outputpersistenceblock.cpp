@@ -37,8 +37,8 @@ const uint INITIAL_BUFFER_SIZE = 1024 * 64;
 
 namespace Sword25 {
 
-OutputPersistenceBlock::OutputPersistenceBlock() {
-	_data.reserve(INITIAL_BUFFER_SIZE);
+OutputPersistenceBlock::OutputPersistenceBlock() : _capacity(INITIAL_BUFFER_SIZE), _blockStream(*this), _blockSizePos(-1) {
+	_data.reserve(_capacity);
 }
 
 void OutputPersistenceBlock::write(const void *data, uint32 size) {
@@ -92,6 +92,23 @@ void OutputPersistenceBlock::writeByteArray(Common::Array<byte> &value) {
 	rawWrite(&value[0], value.size());
 }
 
+Common::WriteStream *OutputPersistenceBlock::beginBlock() {
+	assert(_blockSizePos < 0);
+	writeMarker(BLOCK_MARKER);
+
+	// The size is patched in endBlock(), once it is known
+	write((uint32)0);
+	_blockSizePos = _data.size() - sizeof(uint32);
+	_blockStream._start = _data.size();
+	return &_blockStream;
+}
+
+void OutputPersistenceBlock::endBlock() {
+	assert(_blockSizePos >= 0);
+	WRITE_LE_UINT32(&_data[_blockSizePos], _data.size() - _blockStream._start);
+	_blockSizePos = -1;
+}
+
 void OutputPersistenceBlock::writeMarker(byte marker) {
 	_data.push_back(marker);
 }
@@ -99,6 +116,13 @@ void OutputPersistenceBlock::writeMarker(byte marker) {
 void OutputPersistenceBlock::rawWrite(const void *dataPtr, size_t size) {
 	if (size > 0) {
 		uint oldSize = _data.size();
+		// Grow geometrically: resize() alone only allocates what is asked
+		// for, which copied the whole buffer again on every later write
+		if (oldSize + size > _capacity) {
+			while (_capacity < oldSize + size)
+				_capacity *= 2;
+			_data.reserve(_capacity);
+		}
 		_data.resize(oldSize + size);
 		memcpy(&_data[oldSize], dataPtr, size);
 	}
@@ -32,6 +32,7 @@
 #ifndef SWORD25_OUTPUTPERSISTENCEBLOCK_H
 #define SWORD25_OUTPUTPERSISTENCEBLOCK_H
 
+#include "common/stream.h"
 #include "sword25/kernel/common.h"
 #include "sword25/kernel/persistenceblock.h"
 
@@ -49,6 +50,19 @@ public:
 	void writeString(const Common::String &string);
 	void writeByteArray(Common::Array<byte> &value);
 
+	/**
+	 * Starts a block whose content is written through the returned stream,
+	 * directly into the persistence block. This avoids serializing large
+	 * data into a temporary buffer first. The block is read back with
+	 * InputPersistenceBlock::readByteArray() or readByteStream().
+	 * @return the stream to write the block content to, valid until endBlock()
+	 */
+	Common::WriteStream *beginBlock();
+	/**
+	 * Finishes the block started with beginBlock().
+	 */
+	void endBlock();
+
 	const void *getData() const {
 		return &_data[0];
 	}
@@ -57,10 +71,32 @@ public:
 	}
 
 private:
+	class BlockWriteStream : public Common::WriteStream {
+	public:
+		BlockWriteStream(OutputPersistenceBlock &block) : _start(0), _block(block) {}
+
+		uint32 write(const void *dataPtr, uint32 dataSize) override {
+			_block.rawWrite(dataPtr, dataSize);
+			return dataSize;
+		}
+		int32 pos() const override {
+			return _block._data.size() - _start;
+		}
+
+		uint32 _start;
+
+	private:
+		OutputPersistenceBlock &_block;
+	};
+
 	void writeMarker(byte marker);
 	void rawWrite(const void *dataPtr, size_t size);
 
 	Common::Array<byte> _data;
+	uint _capacity;
+	BlockWriteStream _blockStream;
+	// Offset of the size of the open block, or -1 if there is none
+	int32 _blockSizePos;
 };
 
 } // End of namespace Sword25
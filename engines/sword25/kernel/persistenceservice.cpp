@@ -373,25 +373,27 @@ bool PersistenceService::loadGame(uint slotID) {
 	}
 #endif
 
-	byte *compressedDataBuffer = new byte[curSavegameInfo.gamedataLength];
 	byte *uncompressedDataBuffer = new byte[curSavegameInfo.gamedataUncompressedLength];
 	Common::String filename = generateSavegameFilename(slotID);
 	file = sfm->openForLoading(filename);
 
 	file->seek(curSavegameInfo.gamedataOffset);
-	file->read(reinterpret_cast<char *>(&compressedDataBuffer[0]), curSavegameInfo.gamedataLength);
-	if (file->err()) {
-		error("Unable to load the gamedata from the savegame file \"%s\".", filename.c_str());
-		delete[] compressedDataBuffer;
-		delete[] uncompressedDataBuffer;
-		return false;
-	}
 
 	// Uncompress game data, if needed.
 	unsigned long uncompressedBufferSize = curSavegameInfo.gamedataUncompressedLength;
 
 	if (uncompressedBufferSize > curSavegameInfo.gamedataLength) {
 		// Older saved game, where the game data was compressed again.
+		byte *compressedDataBuffer = new byte[curSavegameInfo.gamedataLength];
+		file->read(reinterpret_cast<char *>(&compressedDataBuffer[0]), curSavegameInfo.gamedataLength);
+		if (file->err()) {
+			error("Unable to load the gamedata from the savegame file \"%s\".", filename.c_str());
+			delete[] compressedDataBuffer;
+			delete[] uncompressedDataBuffer;
+			delete file;
+			return false;
+		}
+
 		if (!Common::uncompress(reinterpret_cast<byte *>(&uncompressedDataBuffer[0]), &uncompressedBufferSize,
 					   reinterpret_cast<byte *>(&compressedDataBuffer[0]), curSavegameInfo.gamedataLength)) {
 			error("Unable to decompress the gamedata from savegame file \"%s\".", filename.c_str());
@@ -400,9 +402,17 @@ bool PersistenceService::loadGame(uint slotID) {
 			delete file;
 			return false;
 		}
+		delete[] compressedDataBuffer;
 	} else {
-		// Newer saved game with uncompressed game data, copy it as-is.
-		memcpy(uncompressedDataBuffer, compressedDataBuffer, uncompressedBufferSize);
+		// Newer saved game with uncompressed game data, read it in place
+		// instead of going through a second buffer.
+		file->read(reinterpret_cast<char *>(&uncompressedDataBuffer[0]), uncompressedBufferSize);
+		if (file->err()) {
+			error("Unable to load the gamedata from the savegame file \"%s\".", filename.c_str());
+			delete[] uncompressedDataBuffer;
+			delete file;
+			return false;
+		}
 	}
 
 	InputPersistenceBlock reader(&uncompressedDataBuffer[0], curSavegameInfo.gamedataUncompressedLength, curSavegameInfo.version);
@@ -416,7 +426,6 @@ bool PersistenceService::loadGame(uint slotID) {
 	success &= Kernel::getInstance()->getSfx()->unpersist(reader);
 	success &= Kernel::getInstance()->getInput()->unpersist(reader);
 
-	delete[] compressedDataBuffer;
 	delete[] uncompressedDataBuffer;
 	delete file;
 
@@ -29,7 +29,6 @@
  *
  */
 
-#include "common/memstream.h"
 #include "common/debug-channels.h"
 
 #include "sword25/sword25.h"
@@ -394,12 +393,9 @@ bool LuaScriptEngine::persist(OutputPersistenceBlock &writer) {
 	pushPermanentsTable(_state, PTT_PERSIST);
 	lua_getglobal(_state, "_G");
 
-	// Lua persists and stores the data in a WriteStream
-	Common::MemoryWriteStreamDynamic writeStream(DisposeAfterUse::YES);
-	Lua::persistLua(_state, &writeStream);
-
-	// Persistenzdaten in den Writer schreiben.
-	writer.write(writeStream.getData(), writeStream.size());
+	// Lua persists and stores the data directly in the writer
+	Lua::persistLua(_state, writer.beginBlock());
+	writer.endBlock();
 
 	// Die beiden Tabellen vom Stack nehmen.
 	lua_pop(_state, 2);
@@ -477,12 +473,13 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	};
 	clearGlobalTable(_state, clearExceptionsSecondPass);
 
-	// Persisted Lua data
-	Common::Array<byte> chunkData;
-	reader.readByteArray(chunkData);
-	Common::MemoryReadStream readStream(&chunkData[0], chunkData.size(), DisposeAfterUse::NO);
+	// Persisted Lua data, read in place from the savegame data
+	Common::SeekableReadStream *readStream = reader.readByteStream();
+	if (!readStream)
+		return false;
 
-	Lua::unpersistLua(_state, &readStream);
+	Lua::unpersistLua(_state, readStream);
+	delete readStream;
 
 	// Permanents-Table is removed from stack
 	lua_remove(_state, -2);
@@ -158,10 +158,10 @@ static void persist(SerializationInfo *info) {
 		info->writeStream->writeByte(0);
 
 		// Retrieve the index from the stack
-		uint *index = (uint *)lua_touserdata(info->luaState, -1);
+		uint index = (uint)lua_tonumber(info->luaState, -1);
 
 		// Write out the index
-		info->writeStream->writeUint32LE(*index);
+		info->writeStream->writeUint32LE(index);
 
 		// Pop the index off the stack
 		lua_pop(info->luaState, 1);
@@ -190,8 +190,9 @@ static void persist(SerializationInfo *info) {
 	lua_pushvalue(info->luaState, -1);
 	// >>>>> permTbl indexTbl rootObj ...... obj obj
 
-	uint *ref = (uint *)lua_newuserdata(info->luaState, sizeof(uint));
-	*ref = ++(info->counter);
+	// Plain numbers as indexes don't need a garbage collected allocation
+	// for every object written
+	lua_pushnumber(info->luaState, (lua_Number)++(info->counter));
 	// >>>>> permTbl indexTbl rootObj ...... obj obj index
 
 	lua_rawset(info->luaState, 2);
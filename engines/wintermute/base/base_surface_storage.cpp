@@ -60,6 +60,7 @@ bool BaseSurfaceStorage::cleanup(bool warn) {
 		delete _surfaces[i];
 	}
 	_surfaces.clear();
+	_surfaceIndex.clear();
 
 	return STATUS_OK;
 }
@@ -91,6 +92,7 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 		if (_surfaces[i] == surface) {
 			_surfaces[i]->_referenceCount--;
 			if (_surfaces[i]->_referenceCount <= 0) {
+				_surfaceIndex.erase(_surfaces[i]->getFileName());
 				delete _surfaces[i];
 				_surfaces.remove_at(i);
 			}
@@ -103,11 +105,10 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 
 //////////////////////////////////////////////////////////////////////
 BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (scumm_stricmp(_surfaces[i]->getFileName(), filename.c_str()) == 0) {
-			_surfaces[i]->_referenceCount++;
-			return _surfaces[i];
-		}
+	SurfaceMap::iterator it = _surfaceIndex.find(filename);
+	if (it != _surfaceIndex.end()) {
+		it->_value->_referenceCount++;
+		return it->_value;
 	}
 
 	if (!BaseFileManager::getEngineInstance()->hasFile(filename)) {
@@ -134,6 +135,7 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 	} else {
 		surface->_referenceCount = 1;
 		_surfaces.push_back(surface);
+		_surfaceIndex[surface->getFileName()] = surface;
 		return surface;
 	}
 }
@@ -31,6 +31,8 @@
 
 #include "engines/wintermute/base/base.h"
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 class BaseSurface;
@@ -50,6 +52,10 @@ public:
 	virtual ~BaseSurfaceStorage();
 
 	Common::Array<BaseSurface *> _surfaces;
+private:
+	// Case-insensitive index of _surfaces by file name
+	typedef Common::HashMap<Common::String, BaseSurface *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SurfaceMap;
+	SurfaceMap _surfaceIndex;
 };
 
 } // End of namespace Wintermute
@@ -58,6 +58,10 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
 	_dirtyRect = nullptr;
+	_dirtyTilesW = _dirtyTilesH = 0;
+	_numDirtyRegions = 0;
+	_numTicketsDrawn = 0;
+	_numTicketsOccluded = 0;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -138,6 +142,12 @@ bool BaseRenderOSystem::initRenderer(int width, int height, bool windowed) {
 	_renderSurface->create(g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat());
 	_blankSurface->create(g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat());
 	_blankSurface->fillRect(Common::Rect(0, 0, _blankSurface->h, _blankSurface->w), _blankSurface->format.ARGBToColor(255, 0, 0, 0));
+
+	_dirtyTilesW = (_renderSurface->w + kDirtyTileSize - 1) / kDirtyTileSize;
+	_dirtyTilesH = (_renderSurface->h + kDirtyTileSize - 1) / kDirtyTileSize;
+	_dirtyTiles.clear();
+	_dirtyTiles.resize(_dirtyTilesW * _dirtyTilesH);
+	clearDirtyRects();
 	_active = true;
 
 	_clearColor = _renderSurface->format.ARGBToColor(255, 0, 0, 0);
@@ -154,8 +164,7 @@ bool BaseRenderOSystem::indicatorFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		clearDirtyRects();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -195,8 +204,7 @@ bool BaseRenderOSystem::flip() {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
 		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		clearDirtyRects();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -371,6 +379,82 @@ void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
 		_dirtyRect->extend(rect);
 	}
 	_dirtyRect->clip(_renderRect);
+
+	Common::Rect tiles(rect);
+	tiles.clip(_renderRect);
+	tiles.clip(_renderSurface->w, _renderSurface->h);
+	if (tiles.isEmpty() || _dirtyTiles.empty()) {
+		return;
+	}
+	int x0 = tiles.left / kDirtyTileSize;
+	int x1 = (tiles.right - 1) / kDirtyTileSize;
+	int y0 = tiles.top / kDirtyTileSize;
+	int y1 = (tiles.bottom - 1) / kDirtyTileSize;
+	for (int y = y0; y <= y1; y++) {
+		for (int x = x0; x <= x1; x++) {
+			_dirtyTiles[y * _dirtyTilesW + x] = true;
+		}
+	}
+}
+
+void BaseRenderOSystem::clearDirtyRects() {
+	delete _dirtyRect;
+	_dirtyRect = nullptr;
+	for (uint i = 0; i < _dirtyTiles.size(); i++) {
+		_dirtyTiles[i] = false;
+	}
+}
+
+void BaseRenderOSystem::getDirtyRegions(Common::Array<Common::Rect> &regions) const {
+	regions.clear();
+	if (!_dirtyRect) {
+		return;
+	}
+	// Index of the first region that may still grow downwards
+	uint openRegions = 0;
+	for (int y = 0; y < _dirtyTilesH; y++) {
+		int16 top = y * kDirtyTileSize;
+		int16 bottom = top + kDirtyTileSize;
+		uint rowStart = regions.size();
+		int x = 0;
+		while (x < _dirtyTilesW) {
+			if (!_dirtyTiles[y * _dirtyTilesW + x]) {
+				x++;
+				continue;
+			}
+			int runStart = x;
+			while (x < _dirtyTilesW && _dirtyTiles[y * _dirtyTilesW + x]) {
+				x++;
+			}
+			int16 left = runStart * kDirtyTileSize;
+			int16 right = x * kDirtyTileSize;
+
+			// Extend a run of the previous row that spans the same columns
+			bool merged = false;
+			for (uint i = openRegions; i < rowStart; i++) {
+				if (regions[i].left == left && regions[i].right == right && regions[i].bottom == top) {
+					regions[i].bottom = bottom;
+					merged = true;
+					break;
+				}
+			}
+			if (!merged) {
+				regions.push_back(Common::Rect(left, top, right, bottom));
+			}
+		}
+		// Regions that did not reach this row can't grow anymore
+		uint i = openRegions;
+		while (i < regions.size()) {
+			if (regions[i].bottom != bottom) {
+				SWAP(regions[i], regions[openRegions]);
+				openRegions++;
+			}
+			i++;
+		}
+	}
+	for (uint i = 0; i < regions.size(); i++) {
+		regions[i].clip(*_dirtyRect);
+	}
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -390,6 +474,9 @@ void BaseRenderOSystem::drawTickets() {
 		}
 	}
 	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+		_numDirtyRegions = 0;
+		_numTicketsDrawn = 0;
+		_numTicketsOccluded = 0;
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -399,43 +486,21 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
-	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
-	// the background color. Typical use-case: Fullscreen FMVs.
-	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
-			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
-		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+
+	Common::Array<Common::Rect> regions;
+	getDirtyRegions(regions);
+	_numDirtyRegions = regions.size();
+	_numTicketsDrawn = 0;
+	_numTicketsOccluded = 0;
+	for (uint i = 0; i < regions.size(); i++) {
+		drawDirtyRegion(regions[i]);
 	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
 
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
-		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -452,6 +517,69 @@ void BaseRenderOSystem::drawTickets() {
 
 }
 
+bool BaseRenderOSystem::isTicketOpaque(const RenderTicket *ticket) const {
+	// Fade-tickets are owner-less and always blended. Rotated and tiled
+	// tickets may leave parts of their destination rect untouched.
+	const Graphics::TransformStruct &transform = ticket->_transform;
+	return ticket->_owner && ticket->getSurface() &&
+	       transform._alphaDisable &&
+	       transform._rgbaMod == Graphics::kDefaultRgbaMod &&
+	       transform._blendMode == Graphics::BLEND_NORMAL &&
+	       transform._angle == Graphics::kDefaultAngle &&
+	       transform._numTimesX * transform._numTimesY == 1;
+}
+
+void BaseRenderOSystem::drawDirtyRegion(const Common::Rect &region) {
+	if (region.isEmpty()) {
+		return;
+	}
+
+	// Everything below the topmost opaque ticket covering the whole region
+	// would be overwritten anyway. Typical use-case: Fullscreen FMVs and
+	// opaque scene backgrounds.
+	RenderQueueIterator it;
+	RenderQueueIterator firstVisible = _renderQueue.begin();
+	bool covered = false;
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		if ((*it)->_dstRect.contains(region) && isTicketOpaque(*it)) {
+			firstVisible = it;
+			covered = true;
+		}
+	}
+
+	if (!covered) {
+		// Apply the clear-color to the dirty region.
+		_renderSurface->fillRect(region, _clearColor);
+	}
+
+	for (it = _renderQueue.begin(); it != firstVisible; ++it) {
+		if ((*it)->_dstRect.intersects(region)) {
+			_numTicketsOccluded++;
+		}
+	}
+	for (; it != _renderQueue.end(); ++it) {
+		RenderTicket *ticket = *it;
+		if (ticket->_dstRect.intersects(region)) {
+			// dstClip is the area we want redrawn.
+			Common::Rect dstClip(ticket->_dstRect);
+			// reduce it to the dirty region
+			dstClip.clip(region);
+			// we need to keep track of the position to redraw the dirty region
+			Common::Rect pos(dstClip);
+			int16 offsetX = ticket->_dstRect.left;
+			int16 offsetY = ticket->_dstRect.top;
+			// convert from screen-coords to surface-coords.
+			dstClip.translate(-offsetX, -offsetY);
+
+			drawFromSurface(ticket, &pos, &dstClip);
+			_numTicketsDrawn++;
+			_needsFlip = true;
+		}
+	}
+
+	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(region.left, region.top), _renderSurface->pitch, region.left, region.top, region.width(), region.height());
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void BaseRenderOSystem::drawFromSurface(RenderTicket *ticket) {
 	ticket->drawToSurface(_renderSurface);
@@ -33,6 +33,7 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "common/list.h"
+#include "common/array.h"
 #include "graphics/transform_struct.h"
 
 namespace Wintermute {
@@ -112,12 +113,38 @@ public:
 	void endSaveLoad();
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
 	BaseSurface *createSurface() override;
+
+	// Statistics of the last frame drawn with dirty rects, for the debugger
+	uint32 getNumDirtyRegions() const { return _numDirtyRegions; }
+	uint32 getNumTicketsDrawn() const { return _numTicketsDrawn; }
+	uint32 getNumTicketsOccluded() const { return _numTicketsOccluded; }
+	uint32 getNumTickets() const { return _renderQueue.size(); }
 private:
 	/**
 	 * Mark a specified rect of the screen as dirty.
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
+	/**
+	 * Forget all dirty rects, including the dirty tiles.
+	 */
+	void clearDirtyRects();
+	/**
+	 * Merge the dirty tiles into as few rects as possible: runs of
+	 * dirty tiles on a tile row become one rect, and runs spanning the
+	 * same columns on consecutive rows are joined.
+	 * @param regions receives the rects, clipped to the dirty rect
+	 */
+	void getDirtyRegions(Common::Array<Common::Rect> &regions) const;
+	/**
+	 * Check whether a ticket overwrites every pixel of its destination rect.
+	 */
+	bool isTicketOpaque(const RenderTicket *ticket) const;
+	/**
+	 * Redraw a single dirty region, skipping the tickets that are hidden
+	 * below an opaque ticket covering the whole region.
+	 */
+	void drawDirtyRegion(const Common::Rect &region);
 	/**
 	 * Traverse the tickets that are dirty, and draw them
 	 */
@@ -127,6 +154,17 @@ private:
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
 	Common::Rect *_dirtyRect;
+	// The screen is split into square tiles, and only the tiles that
+	// were touched by a dirty rect are redrawn
+	enum {
+		kDirtyTileSize = 32
+	};
+	Common::Array<bool> _dirtyTiles;
+	int _dirtyTilesW;
+	int _dirtyTilesH;
+	uint32 _numDirtyRegions;
+	uint32 _numTicketsDrawn;
+	uint32 _numTicketsOccluded;
 	Common::List<RenderTicket *> _renderQueue;
 
 	bool _needsFlip;
@@ -176,14 +176,16 @@ ScValue *ScValue::getProp(const char *name) {
 		return _gameRef->_scValue;
 	}
 
+	// build the key once; both the native lookup and the hashmap need it
+	const Common::String key(name);
 	ScValue *ret = nullptr;
 
 	if (_type == VAL_NATIVE && _valNative) {
-		ret = _valNative->scGetProperty(name);
+		ret = _valNative->scGetProperty(key);
 	}
 
 	if (ret == nullptr) {
-		_valIter = _valObject.find(name);
+		_valIter = _valObject.find(key);
 		if (_valIter != _valObject.end()) {
 			ret = _valIter->_value;
 		}
@@ -222,9 +224,12 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 	if (DID_FAIL(ret)) {
 		ScValue *newVal = nullptr;
 
-		_valIter = _valObject.find(name);
-		if (_valIter != _valObject.end()) {
-			newVal = _valIter->_value;
+		const Common::String key(name);
+		// copy() below may move _valIter (val can be this object), so keep the
+		// slot found here in a local iterator
+		Common::HashMap<Common::String, ScValue *>::iterator slot = _valObject.find(key);
+		if (slot != _valObject.end()) {
+			newVal = slot->_value;
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
@@ -234,7 +239,12 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
+		// reuse the slot found above instead of hashing the name again
+		if (slot != _valObject.end()) {
+			slot->_value = newVal;
+		} else {
+			_valObject[key] = newVal;
+		}
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -743,8 +753,9 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
-			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
-			_valObject[orig->_valIter->_key]->copy(orig->_valIter->_value);
+			ScValue *newVal = new ScValue(_gameRef);
+			newVal->copy(orig->_valIter->_value);
+			_valObject[orig->_valIter->_key] = newVal;
 			orig->_valIter++;
 		}
 	} else {
@@ -0,0 +1,142 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/transparent_surface.h"
+
+/**
+ * Compares the blitters of Graphics::TransparentSurface against a plain
+ * per pixel reference of the blending formulas. The widths cover both the
+ * vectorized part of a row and the leftover pixels.
+ */
+class TransparentSurfaceTestSuite : public CxxTest::TestSuite
+{
+	uint32 _seed;
+
+	uint32 nextRandom() {
+		_seed = _seed * 1103515245 + 12345;
+		return _seed >> 8 | _seed << 24;
+	}
+
+	static uint32 channel(uint32 pix, int shift) {
+		return (pix >> shift) & 0xFF;
+	}
+
+	// Pixels are stored as R << 24 | G << 16 | B << 8 | A
+	static uint32 pixel(uint32 a, uint32 r, uint32 g, uint32 b) {
+		return (r << 24) | (g << 16) | (b << 8) | a;
+	}
+
+	void fillRandom(Graphics::Surface &surf) {
+		for (int y = 0; y < surf.h; y++) {
+			for (int x = 0; x < surf.w; x++) {
+				uint32 pix = nextRandom();
+				// Make fully transparent and fully opaque pixels common
+				switch (nextRandom() & 3) {
+				case 0:
+					pix &= 0xFFFFFF00;
+					break;
+				case 1:
+					pix |= 0xFF;
+					break;
+				default:
+					break;
+				}
+				*(uint32 *)surf.getBasePtr(x, y) = pix;
+			}
+		}
+	}
+
+	static uint32 blendReference(Graphics::AlphaType mode, uint color, uint32 in, uint32 out) {
+		uint32 ina = channel(in, 0);
+		switch (mode) {
+		case Graphics::ALPHA_OPAQUE:
+			if (color == 0xFFFFFFFF)
+				return in | 0xFF;
+			break;
+		case Graphics::ALPHA_BINARY:
+			if (color == 0xFFFFFFFF)
+				return ina != 0 ? (in | 0xFF) : out;
+			break;
+		default:
+			break;
+		}
+
+		if (color == 0xFFFFFFFF) {
+			if (ina == 0)
+				return out;
+			uint32 c[3];
+			for (int i = 0; i < 3; i++) {
+				int shift = 8 * (i + 1);
+				c[i] = (channel(in, shift) * ina + channel(out, shift) * (255 - ina)) >> 8;
+			}
+			return pixel(255, c[2], c[1], c[0]);
+		}
+
+		ina = ina * ((color >> 24) & 0xFF) >> 8;
+		uint32 c[3];
+		for (int i = 0; i < 3; i++) {
+			int shift = 8 * (i + 1);
+			uint32 mod = (color >> (8 * i)) & 0xFF;
+			c[i] = ((channel(out, shift) * (255 - ina) >> 8) + (channel(in, shift) * ina * mod >> 16)) & 0xFF;
+		}
+		return pixel(255, c[2], c[1], c[0]);
+	}
+
+	void checkBlit(Graphics::AlphaType mode, uint color, int flipping) {
+		const Graphics::PixelFormat format = Graphics::TransparentSurface::getSupportedPixelFormat();
+		_seed = 1;
+
+		for (int width = 1; width <= 13; width++) {
+			Graphics::TransparentSurface src;
+			Graphics::Surface dst;
+			src.create(width, 3, format);
+			dst.create(width, 3, format);
+			fillRandom(src);
+			fillRandom(dst);
+
+			Graphics::Surface expected;
+			expected.copyFrom(dst);
+			for (int y = 0; y < dst.h; y++) {
+				for (int x = 0; x < dst.w; x++) {
+					int srcX = (flipping & Graphics::FLIP_H) ? width - 1 - x : x;
+					uint32 in = *(const uint32 *)src.getBasePtr(srcX, y);
+					uint32 *out = (uint32 *)expected.getBasePtr(x, y);
+					*out = blendReference(mode, color, in, *out);
+				}
+			}
+
+			src.setAlphaMode(mode);
+			src.blit(dst, 0, 0, flipping, nullptr, color);
+
+			for (int y = 0; y < dst.h; y++) {
+				for (int x = 0; x < dst.w; x++) {
+					TS_ASSERT_EQUALS(*(const uint32 *)dst.getBasePtr(x, y), *(const uint32 *)expected.getBasePtr(x, y));
+				}
+			}
+
+			src.free();
+			dst.free();
+			expected.free();
+		}
+	}
+
+	public:
+	void test_blit_opaque() {
+		checkBlit(Graphics::ALPHA_OPAQUE, 0xFFFFFFFF, Graphics::FLIP_NONE);
+	}
+
+	void test_blit_binary() {
+		checkBlit(Graphics::ALPHA_BINARY, 0xFFFFFFFF, Graphics::FLIP_NONE);
+		checkBlit(Graphics::ALPHA_BINARY, 0xFFFFFFFF, Graphics::FLIP_H);
+	}
+
+	void test_blit_alpha() {
+		checkBlit(Graphics::ALPHA_FULL, 0xFFFFFFFF, Graphics::FLIP_NONE);
+		checkBlit(Graphics::ALPHA_FULL, 0xFFFFFFFF, Graphics::FLIP_H);
+	}
+
+	void test_blit_alpha_colormod() {
+		checkBlit(Graphics::ALPHA_FULL, 0x80FF4010, Graphics::FLIP_NONE);
+		checkBlit(Graphics::ALPHA_FULL, 0xFF204080, Graphics::FLIP_H);
+		checkBlit(Graphics::ALPHA_BINARY, 0xC0C0C0C0, Graphics::FLIP_NONE);
+	}
+};